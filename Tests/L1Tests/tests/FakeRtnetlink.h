@@ -0,0 +1,207 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2024 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+#pragma once
+
+#include <arpa/inet.h>
+#include <cstring>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <sys/socket.h>
+#include <unistd.h>
+
+// The kernel side of an RTNETLINK socket on one end of a socketpair: it
+// answers the link and address dumps from the links set up here and sends
+// the events it is told to, so tests do not depend on the interfaces of the
+// build host. The other end is handed to NetlinkMonitor::Start().
+class FakeRtnetlink {
+public:
+    FakeRtnetlink(const FakeRtnetlink&) = delete;
+    FakeRtnetlink& operator=(const FakeRtnetlink&) = delete;
+
+    FakeRtnetlink()
+        : _lock()
+        , _kernel(-1)
+        , _socket(-1)
+        , _links()
+        , _addresses()
+        , _thread()
+    {
+        int ends[2];
+        if (socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0, ends) == 0) {
+            _kernel = ends[0];
+            _socket = ends[1];
+            _thread = std::thread(&FakeRtnetlink::Serve, this);
+        }
+    }
+    ~FakeRtnetlink()
+    {
+        if (_kernel >= 0) {
+            shutdown(_kernel, SHUT_RDWR);
+            _thread.join();
+            close(_kernel);
+        }
+        if (_socket >= 0) {
+            close(_socket);
+        }
+    }
+
+    // The end for NetlinkMonitor::Start(), which takes it over.
+    int Socket()
+    {
+        const int result = _socket;
+        _socket = -1;
+        return (result);
+    }
+
+    // Link and address state answered to the next dump.
+    void Link(const int index, const std::string& name, const std::vector<uint8_t>& mac, const uint32_t flags)
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _links[index] = NewLink(RTM_NEWLINK, 0, index, name, mac, flags);
+    }
+    void Address(const int index, const uint8_t family, const std::string& address, const uint8_t prefix, const uint8_t scope)
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _addresses.push_back(NewAddress(RTM_NEWADDR, 0, index, family, address, prefix, scope));
+    }
+
+    // Sends an RTM_NEWADDR or RTM_DELADDR event; it does not change what the next dump answers.
+    void AddressEvent(const uint16_t type, const int index, const uint8_t family, const std::string& address, const uint8_t prefix, const uint8_t scope)
+    {
+        const std::string message = NewAddress(type, 0, index, family, address, prefix, scope);
+        std::lock_guard<std::mutex> guard(_lock);
+        send(_kernel, message.data(), message.size(), MSG_NOSIGNAL);
+    }
+
+private:
+    void Serve()
+    {
+        alignas(struct nlmsghdr) char buffer[1024];
+
+        while (true) {
+            const ssize_t received = recv(_kernel, buffer, sizeof(buffer), 0);
+            if (received < static_cast<ssize_t>(sizeof(struct nlmsghdr))) {
+                break;
+            }
+
+            const struct nlmsghdr* request = reinterpret_cast<const struct nlmsghdr*>(buffer);
+            std::string reply;
+
+            _lock.lock();
+            if (request->nlmsg_type == RTM_GETLINK) {
+                for (const auto& link : _links) {
+                    reply += Sequenced(link.second, request->nlmsg_seq);
+                }
+            } else if (request->nlmsg_type == RTM_GETADDR) {
+                for (const std::string& address : _addresses) {
+                    reply += Sequenced(address, request->nlmsg_seq);
+                }
+            }
+            const int status = 0;
+            reply += Message(NLMSG_DONE, request->nlmsg_seq, &status, sizeof(status));
+            send(_kernel, reply.data(), reply.size(), MSG_NOSIGNAL);
+            _lock.unlock();
+        }
+    }
+
+    static std::string Sequenced(std::string message, const uint32_t sequence)
+    {
+        reinterpret_cast<struct nlmsghdr*>(&message[0])->nlmsg_seq = sequence;
+        return (message);
+    }
+
+    static void Attribute(std::string& message, const uint16_t type, const void* data, const size_t length)
+    {
+        struct rtattr attribute;
+        attribute.rta_len = RTA_LENGTH(length);
+        attribute.rta_type = type;
+
+        message.append(reinterpret_cast<const char*>(&attribute), sizeof(attribute));
+        message.append(static_cast<const char*>(data), length);
+        message.append(RTA_SPACE(length) - RTA_LENGTH(length), '\0');
+    }
+
+    static std::string Message(const uint16_t type, const uint32_t sequence, const void* body, const size_t length)
+    {
+        struct nlmsghdr header;
+        memset(&header, 0, sizeof(header));
+        header.nlmsg_len = NLMSG_LENGTH(length);
+        header.nlmsg_type = type;
+        header.nlmsg_seq = sequence;
+
+        std::string message(reinterpret_cast<const char*>(&header), sizeof(header));
+        message.append(static_cast<const char*>(body), length);
+        message.append(NLMSG_ALIGN(length) - length, '\0');
+        return (message);
+    }
+
+    static void Close(std::string& message)
+    {
+        reinterpret_cast<struct nlmsghdr*>(&message[0])->nlmsg_len = message.size();
+    }
+
+    static std::string NewLink(const uint16_t type, const uint32_t sequence, const int index, const std::string& name, const std::vector<uint8_t>& mac, const uint32_t flags)
+    {
+        struct ifinfomsg info;
+        memset(&info, 0, sizeof(info));
+        info.ifi_family = AF_UNSPEC;
+        info.ifi_index = index;
+        info.ifi_flags = flags;
+
+        std::string message = Message(type, sequence, &info, sizeof(info));
+        Attribute(message, IFLA_IFNAME, name.c_str(), name.length() + 1);
+        if (mac.empty() == false) {
+            Attribute(message, IFLA_ADDRESS, mac.data(), mac.size());
+        }
+        Close(message);
+        return (message);
+    }
+
+    static std::string NewAddress(const uint16_t type, const uint32_t sequence, const int index, const uint8_t family, const std::string& address, const uint8_t prefix, const uint8_t scope)
+    {
+        struct ifaddrmsg info;
+        memset(&info, 0, sizeof(info));
+        info.ifa_family = family;
+        info.ifa_prefixlen = prefix;
+        info.ifa_scope = scope;
+        info.ifa_index = static_cast<uint32_t>(index);
+
+        uint8_t binary[16];
+        inet_pton(family, address.c_str(), binary);
+
+        std::string message = Message(type, sequence, &info, sizeof(info));
+        Attribute(message, IFA_ADDRESS, binary, (family == AF_INET) ? 4 : 16);
+        Close(message);
+        return (message);
+    }
+
+private:
+    std::mutex _lock;
+    int _kernel;
+    int _socket;
+    std::map<int, std::string> _links;
+    std::vector<std::string> _addresses;
+    std::thread _thread;
+};
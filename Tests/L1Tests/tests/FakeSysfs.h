@@ -0,0 +1,76 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2024 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// A throwaway tree laid out like /sys/class/thermal/ and /sys/devices/system/cpu/.
+class FakeSysfs {
+public:
+    FakeSysfs(const FakeSysfs&) = delete;
+    FakeSysfs& operator=(const FakeSysfs&) = delete;
+
+    FakeSysfs()
+        : _root()
+        , _created()
+    {
+        char directory[] = "/tmp/FakeSysfsXXXXXX";
+        if (mkdtemp(directory) != nullptr) {
+            _root = directory;
+        }
+    }
+    ~FakeSysfs()
+    {
+        for (auto path = _created.rbegin(); path != _created.rend(); ++path) {
+            remove(path->c_str());
+        }
+        rmdir(_root.c_str());
+    }
+
+    std::string Thermal() const { return (_root + "/thermal/"); }
+    std::string Cpus() const { return (_root + "/cpu/"); }
+
+    // Creates the missing directories of the path; rewriting keeps the inode an open reader holds.
+    void Write(const std::string& path, const std::string& value)
+    {
+        const std::string file = _root + "/" + path;
+        for (size_t slash = file.find('/', _root.length() + 1); slash != std::string::npos; slash = file.find('/', slash + 1)) {
+            const std::string directory = file.substr(0, slash);
+            if (mkdir(directory.c_str(), 0755) == 0) {
+                _created.push_back(directory);
+            }
+        }
+        if (std::find(_created.begin(), _created.end(), file) == _created.end()) {
+            _created.push_back(file);
+        }
+        std::ofstream(file) << value << "\n";
+    }
+
+private:
+    std::string _root;
+    std::vector<std::string> _created;
+};
@@ -27,7 +27,9 @@
 #include "ManagerMock.h"
 #include "ServiceMock.h"
 #include "SystemInfo.h"
+#include "dsMgr.h"
 #include <fstream>
+#include <map>
 #include "ThunderPortability.h"
 
 using namespace WPEFramework;
@@ -54,6 +56,8 @@ protected:
     HostImplMock* p_hostImplMock = nullptr;
     AudioOutputPortMock* p_audioOutputPortMock = nullptr;
     NiceMock<ServiceMock> service;
+    // What DeviceAudioCapabilities registered with the IARM bus, per DSMGR event.
+    std::map<IARM_EventId_t, IARM_EventHandler_t> dsEventHandlers;
 
     DeviceAudioCapabilitiesTest()
         : plugin(Core::ProxyType<Plugin::DeviceInfo>::Create())
@@ -72,6 +76,14 @@ protected:
         p_audioOutputPortMock = new NiceMock<AudioOutputPortMock>;
         device::AudioOutputPort::setImpl(p_audioOutputPortMock);
 
+        ON_CALL(*p_iarmBusImplMock, IARM_Bus_RegisterEventHandler(_, _, _))
+            .WillByDefault(Invoke([this](const char* ownerName, IARM_EventId_t eventId, IARM_EventHandler_t handler) {
+                if (strcmp(ownerName, IARM_BUS_DSMGR_NAME) == 0) {
+                    dsEventHandlers[eventId] = handler;
+                }
+                return IARM_RESULT_SUCCESS;
+            }));
+
         ON_CALL(service, ConfigLine())
             .WillByDefault(Return("{\"root\":{\"mode\":\"Off\"}}"));
         ON_CALL(service, WebPrefix())
@@ -108,6 +120,14 @@ protected:
             p_iarmBusImplMock = nullptr;
         }
     }
+
+    // Delivers a DSMGR event the way the IARM bus does.
+    void RaiseDsEvent(const IARM_EventId_t eventId)
+    {
+        auto entry = dsEventHandlers.find(eventId);
+        ASSERT_TRUE(entry != dsEventHandlers.end());
+        entry->second(IARM_BUS_DSMGR_NAME, eventId, nullptr, 0);
+    }
 };
 
 TEST_F(DeviceAudioCapabilitiesTest, AudioCapabilities_Success_EmptyPort_AllCapabilities)
@@ -1008,6 +1028,9 @@ TEST_F(DeviceAudioCapabilitiesTest, AudioCapabilities_Positive_AllIndividualCapa
     EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("audiocapabilities"), _T("{\"audioPort\":\"HDMI0\"}"), response));
     EXPECT_TRUE(response.find("\"ATMOS\"") != string::npos);
 
+    // The port's answer is kept until DS reports a change.
+    RaiseDsEvent(IARM_BUS_DSMGR_EVENT_AUDIO_MODE);
+
     // Test DD only
     EXPECT_CALL(*p_audioOutputPortMock, getAudioCapabilities(_))
         .WillOnce(Invoke([](int* capabilities) {
@@ -1018,6 +1041,8 @@ TEST_F(DeviceAudioCapabilitiesTest, AudioCapabilities_Positive_AllIndividualCapa
     EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("audiocapabilities"), _T("{\"audioPort\":\"HDMI0\"}"), response));
     EXPECT_TRUE(response.find("\"DOLBY_DIGITAL\"") != string::npos);
 
+    RaiseDsEvent(IARM_BUS_DSMGR_EVENT_AUDIO_MODE);
+
     // Test DDPLUS only
     EXPECT_CALL(*p_audioOutputPortMock, getAudioCapabilities(_))
         .WillOnce(Invoke([](int* capabilities) {
@@ -1028,6 +1053,8 @@ TEST_F(DeviceAudioCapabilitiesTest, AudioCapabilities_Positive_AllIndividualCapa
     EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("audiocapabilities"), _T("{\"audioPort\":\"HDMI0\"}"), response));
     EXPECT_TRUE(response.find("\"DOLBY_DIGITAL_PLUS\"") != string::npos);
 
+    RaiseDsEvent(IARM_BUS_DSMGR_EVENT_AUDIO_MODE);
+
     // Test DAD only
     EXPECT_CALL(*p_audioOutputPortMock, getAudioCapabilities(_))
         .WillOnce(Invoke([](int* capabilities) {
@@ -1038,6 +1065,8 @@ TEST_F(DeviceAudioCapabilitiesTest, AudioCapabilities_Positive_AllIndividualCapa
     EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("audiocapabilities"), _T("{\"audioPort\":\"HDMI0\"}"), response));
     EXPECT_TRUE(response.find("\"Dual_Audio_Decode\"") != string::npos);
 
+    RaiseDsEvent(IARM_BUS_DSMGR_EVENT_AUDIO_MODE);
+
     // Test DAPv2 only
     EXPECT_CALL(*p_audioOutputPortMock, getAudioCapabilities(_))
         .WillOnce(Invoke([](int* capabilities) {
@@ -1048,6 +1077,8 @@ TEST_F(DeviceAudioCapabilitiesTest, AudioCapabilities_Positive_AllIndividualCapa
     EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("audiocapabilities"), _T("{\"audioPort\":\"HDMI0\"}"), response));
     EXPECT_TRUE(response.find("\"DAPv2\"") != string::npos);
 
+    RaiseDsEvent(IARM_BUS_DSMGR_EVENT_AUDIO_MODE);
+
     // Test MS12 only
     EXPECT_CALL(*p_audioOutputPortMock, getAudioCapabilities(_))
         .WillOnce(Invoke([](int* capabilities) {
@@ -1076,6 +1107,9 @@ TEST_F(DeviceAudioCapabilitiesTest, AudioCapabilities_Positive_CombinationSubset
     EXPECT_TRUE(response.find("\"DOLBY_DIGITAL\"") != string::npos);
     EXPECT_FALSE(response.find("\"DOLBY_DIGITAL_PLUS\"") != string::npos);
 
+    // The port's answer is kept until DS reports a change.
+    RaiseDsEvent(IARM_BUS_DSMGR_EVENT_AUDIO_MODE);
+
     // Test DD + DDPLUS + DAD
     EXPECT_CALL(*p_audioOutputPortMock, getAudioCapabilities(_))
         .WillOnce(Invoke([](int* capabilities) {
@@ -1088,6 +1122,8 @@ TEST_F(DeviceAudioCapabilitiesTest, AudioCapabilities_Positive_CombinationSubset
     EXPECT_TRUE(response.find("\"DOLBY_DIGITAL_PLUS\"") != string::npos);
     EXPECT_TRUE(response.find("\"Dual_Audio_Decode\"") != string::npos);
 
+    RaiseDsEvent(IARM_BUS_DSMGR_EVENT_AUDIO_MODE);
+
     // Test DAPv2 + MS12
     EXPECT_CALL(*p_audioOutputPortMock, getAudioCapabilities(_))
         .WillOnce(Invoke([](int* capabilities) {
@@ -1137,6 +1173,9 @@ TEST_F(DeviceAudioCapabilitiesTest, MS12Capabilities_Positive_AllIndividualCapab
     EXPECT_TRUE(response.find("\"Dolby_Volume\"") != string::npos);
     EXPECT_FALSE(response.find("\"Inteligent_Equalizer\"") != string::npos);
 
+    // The port's answer is kept until DS reports a change.
+    RaiseDsEvent(IARM_BUS_DSMGR_EVENT_AUDIO_MODE);
+
     // Test Intelligent Equalizer only
     EXPECT_CALL(*p_audioOutputPortMock, getMS12Capabilities(_))
         .WillOnce(Invoke([](int* capabilities) {
@@ -1148,6 +1187,8 @@ TEST_F(DeviceAudioCapabilitiesTest, MS12Capabilities_Positive_AllIndividualCapab
     EXPECT_TRUE(response.find("\"Inteligent_Equalizer\"") != string::npos);
     EXPECT_FALSE(response.find("\"Dolby_Volume\"") != string::npos);
 
+    RaiseDsEvent(IARM_BUS_DSMGR_EVENT_AUDIO_MODE);
+
     // Test Dialogue Enhancer only
     EXPECT_CALL(*p_audioOutputPortMock, getMS12Capabilities(_))
         .WillOnce(Invoke([](int* capabilities) {
@@ -1177,6 +1218,9 @@ TEST_F(DeviceAudioCapabilitiesTest, MS12Capabilities_Positive_CombinationSubsets
     EXPECT_TRUE(response.find("\"Inteligent_Equalizer\"") != string::npos);
     EXPECT_FALSE(response.find("\"Dialogue_Enhancer\"") != string::npos);
 
+    // The port's answer is kept until DS reports a change.
+    RaiseDsEvent(IARM_BUS_DSMGR_EVENT_AUDIO_MODE);
+
     // Test Equalizer + Enhancer
     EXPECT_CALL(*p_audioOutputPortMock, getMS12Capabilities(_))
         .WillOnce(Invoke([](int* capabilities) {
@@ -1189,6 +1233,8 @@ TEST_F(DeviceAudioCapabilitiesTest, MS12Capabilities_Positive_CombinationSubsets
     EXPECT_TRUE(response.find("\"Dialogue_Enhancer\"") != string::npos);
     EXPECT_FALSE(response.find("\"Dolby_Volume\"") != string::npos);
 
+    RaiseDsEvent(IARM_BUS_DSMGR_EVENT_AUDIO_MODE);
+
     // Test Volume + Enhancer
     EXPECT_CALL(*p_audioOutputPortMock, getMS12Capabilities(_))
         .WillOnce(Invoke([](int* capabilities) {
@@ -1277,6 +1323,9 @@ TEST_F(DeviceAudioCapabilitiesTest, SupportedMS12AudioProfiles_Positive_VariousP
     EXPECT_TRUE(response.find("\"Music\"") != string::npos);
     EXPECT_FALSE(response.find("\"Voice\"") != string::npos);
 
+    // The port's answer is kept until DS reports a change.
+    RaiseDsEvent(IARM_BUS_DSMGR_EVENT_AUDIO_MODE);
+
     // Test with 4 profiles
     std::vector<std::string> profiles2 = {"Movie", "Music", "Voice", "Sport"};
     EXPECT_CALL(*p_audioOutputPortMock, getMS12AudioProfileList())
@@ -1474,33 +1523,31 @@ TEST_F(DeviceAudioCapabilitiesTest, EdgeCase_SequentialCallsSamePort)
 {
     device::AudioOutputPort audioOutputPort;
     string portName = "HDMI0";
+    std::vector<std::string> profiles = {"Movie"};
 
-    // First call
+    // One port lookup answers all three calls.
     EXPECT_CALL(*p_audioOutputPortMock, getAudioCapabilities(_))
         .WillOnce(Invoke([](int* capabilities) {
             *capabilities = dsAUDIOSUPPORT_ATMOS;
         }));
-    EXPECT_CALL(*p_hostImplMock, getAudioOutputPort(portName))
-        .WillOnce(ReturnRef(audioOutputPort));
-    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("audiocapabilities"), _T("{\"audioPort\":\"HDMI0\"}"), response));
-    EXPECT_TRUE(response.find("\"ATMOS\"") != string::npos);
-
-    // Second call
     EXPECT_CALL(*p_audioOutputPortMock, getMS12Capabilities(_))
         .WillOnce(Invoke([](int* capabilities) {
             *capabilities = dsMS12SUPPORT_DolbyVolume;
         }));
+    EXPECT_CALL(*p_audioOutputPortMock, getMS12AudioProfileList())
+        .WillOnce(Return(profiles));
     EXPECT_CALL(*p_hostImplMock, getAudioOutputPort(portName))
         .WillOnce(ReturnRef(audioOutputPort));
+
+    // First call
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("audiocapabilities"), _T("{\"audioPort\":\"HDMI0\"}"), response));
+    EXPECT_TRUE(response.find("\"ATMOS\"") != string::npos);
+
+    // Second call
     EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("ms12capabilities"), _T("{\"audioPort\":\"HDMI0\"}"), response));
     EXPECT_TRUE(response.find("\"Dolby_Volume\"") != string::npos);
 
     // Third call
-    std::vector<std::string> profiles = {"Movie"};
-    EXPECT_CALL(*p_audioOutputPortMock, getMS12AudioProfileList())
-        .WillOnce(Return(profiles));
-    EXPECT_CALL(*p_hostImplMock, getAudioOutputPort(portName))
-        .WillOnce(ReturnRef(audioOutputPort));
     EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("supportedms12audioprofiles"), _T("{\"audioPort\":\"HDMI0\"}"), response));
     EXPECT_TRUE(response.find("\"Movie\"") != string::npos);
 }
@@ -1518,6 +1565,7 @@ TEST_F(DeviceAudioCapabilitiesTest, EdgeCase_AlternatingPortCalls)
     EXPECT_CALL(*p_hostImplMock, getAudioOutputPort(port1))
         .WillOnce(ReturnRef(audioOutputPort));
     EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("audiocapabilities"), _T("{\"audioPort\":\"HDMI0\"}"), response));
+    EXPECT_TRUE(response.find("\"ATMOS\"") != string::npos);
 
     // Call for SPDIF
     string port2 = "SPDIF";
@@ -1528,13 +1576,104 @@ TEST_F(DeviceAudioCapabilitiesTest, EdgeCase_AlternatingPortCalls)
     EXPECT_CALL(*p_hostImplMock, getAudioOutputPort(port2))
         .WillOnce(ReturnRef(audioOutputPort));
     EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("audiocapabilities"), _T("{\"audioPort\":\"SPDIF\"}"), response));
+    EXPECT_TRUE(response.find("\"DOLBY_DIGITAL\"") != string::npos);
 
-    // Call for HDMI0 again
+    // Call for HDMI0 again, answered from its cached entry
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("audiocapabilities"), _T("{\"audioPort\":\"HDMI0\"}"), response));
+    EXPECT_TRUE(response.find("\"ATMOS\"") != string::npos);
+    EXPECT_FALSE(response.find("\"DOLBY_DIGITAL\"") != string::npos);
+}
+
+TEST_F(DeviceAudioCapabilitiesTest, AudioCapabilities_Success_CachedUntilDsEvent)
+{
+    device::AudioOutputPort audioOutputPort;
+    const IARM_EventId_t events[] = {
+        IARM_BUS_DSMGR_EVENT_HDMI_HOTPLUG,
+        IARM_BUS_DSMGR_EVENT_AUDIO_OUT_HOTPLUG,
+        IARM_BUS_DSMGR_EVENT_AUDIO_MODE,
+        IARM_BUS_DSMGR_EVENT_ATMOS_CAPS_CHANGED
+    };
+    int capabilities = dsAUDIOSUPPORT_ATMOS;
+
+    EXPECT_EQ(dsEventHandlers.size(), 4u);
+
+    // One port lookup up front and one after each event.
+    EXPECT_CALL(*p_hostImplMock, getAudioOutputPort(_))
+        .Times(5)
+        .WillRepeatedly(ReturnRef(audioOutputPort));
     EXPECT_CALL(*p_audioOutputPortMock, getAudioCapabilities(_))
-        .WillOnce(Invoke([](int* capabilities) {
-            *capabilities = dsAUDIOSUPPORT_DDPLUS;
+        .Times(5)
+        .WillRepeatedly(Invoke([&capabilities](int* answer) {
+            *answer = capabilities;
         }));
-    EXPECT_CALL(*p_hostImplMock, getAudioOutputPort(port1))
+
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("audiocapabilities"), _T("{\"audioPort\":\"HDMI0\"}"), response));
+    EXPECT_TRUE(response.find("\"ATMOS\"") != string::npos);
+
+    for (const IARM_EventId_t event : events) {
+        const bool atmos = (capabilities == dsAUDIOSUPPORT_ATMOS);
+
+        // Until DS reports it, a change is not seen.
+        capabilities = (atmos == true) ? dsAUDIOSUPPORT_DD : dsAUDIOSUPPORT_ATMOS;
+        EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("audiocapabilities"), _T("{\"audioPort\":\"HDMI0\"}"), response));
+        EXPECT_EQ(response.find("\"ATMOS\"") != string::npos, atmos);
+
+        RaiseDsEvent(event);
+
+        EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("audiocapabilities"), _T("{\"audioPort\":\"HDMI0\"}"), response));
+        EXPECT_EQ(response.find("\"ATMOS\"") != string::npos, !atmos);
+        EXPECT_EQ(response.find("\"DOLBY_DIGITAL\"") != string::npos, atmos);
+    }
+}
+
+TEST_F(DeviceAudioCapabilitiesTest, MS12AudioProfiles_Success_DefaultPortResolvedOnce)
+{
+    device::AudioOutputPort audioOutputPort;
+    const string defaultPort(_T("HDMI0"));
+
+    EXPECT_CALL(*p_hostImplMock, getDefaultAudioPortName())
+        .Times(1)
+        .WillOnce(Return(defaultPort));
+    EXPECT_CALL(*p_hostImplMock, getAudioOutputPort(defaultPort))
+        .Times(1)
         .WillOnce(ReturnRef(audioOutputPort));
+    EXPECT_CALL(*p_audioOutputPortMock, getMS12AudioProfileList())
+        .Times(1)
+        .WillOnce(Return(std::vector<std::string>({ "Movie", "Music" })));
+
+    for (int call = 0; call < 3; call++) {
+        EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("supportedms12audioprofiles"), _T("{\"audioPort\":\"\"}"), response));
+        EXPECT_TRUE(response.find("\"Music\"") != string::npos);
+    }
+}
+
+TEST_F(DeviceAudioCapabilitiesTest, AudioCapabilities_Success_FailedGetterRetriedAlone)
+{
+    device::AudioOutputPort audioOutputPort;
+
+    EXPECT_CALL(*p_hostImplMock, getAudioOutputPort(_))
+        .Times(2)
+        .WillRepeatedly(ReturnRef(audioOutputPort));
+    EXPECT_CALL(*p_audioOutputPortMock, getAudioCapabilities(_))
+        .Times(1)
+        .WillOnce(Invoke([](int* capabilities) { *capabilities = dsAUDIOSUPPORT_DD; }));
+    EXPECT_CALL(*p_audioOutputPortMock, getMS12Capabilities(_))
+        .Times(2)
+        .WillOnce(Invoke([](int*) { throw device::Exception("Test exception"); }))
+        .WillOnce(Invoke([](int* capabilities) { *capabilities = dsMS12SUPPORT_DolbyVolume; }));
+    EXPECT_CALL(*p_audioOutputPortMock, getMS12AudioProfileList())
+        .Times(1)
+        .WillOnce(Return(std::vector<std::string>({ "Music" })));
+
+    // The port's audio capabilities and profiles are cached, its MS12 capabilities are not.
     EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("audiocapabilities"), _T("{\"audioPort\":\"HDMI0\"}"), response));
+    EXPECT_TRUE(response.find("\"DOLBY_DIGITAL\"") != string::npos);
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("supportedms12audioprofiles"), _T("{\"audioPort\":\"HDMI0\"}"), response));
+    EXPECT_TRUE(response.find("\"Music\"") != string::npos);
+
+    // The next lookup of the port only asks for them.
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("ms12capabilities"), _T("{\"audioPort\":\"HDMI0\"}"), response));
+    EXPECT_TRUE(response.find("\"Dolby_Volume\"") != string::npos);
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("ms12capabilities"), _T("{\"audioPort\":\"HDMI0\"}"), response));
+    EXPECT_TRUE(response.find("\"Dolby_Volume\"") != string::npos);
 }
@@ -0,0 +1,63 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2024 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+
+#include <gtest/gtest.h>
+
+#include "DeviceDetailsCoprocess.h"
+#include <fstream>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace WPEFramework;
+
+TEST(DeviceDetailsCoprocessTest, AnswersFromOneHelperAndRestartsAfterTimeout)
+{
+    char path[] = "/tmp/getDeviceDetailsTestXXXXXX";
+    const int descriptor = mkstemp(path);
+    ASSERT_GE(descriptor, 0);
+    close(descriptor);
+
+    {
+        std::ofstream script(path);
+        script << "#!/bin/sh\n"
+               << "case \"$2\" in\n"
+               << "  slow) sleep 5 ;;\n"
+               << "  fail) echo partial; exit 1 ;;\n"
+               << "  *) echo \"$1:$2\" ;;\n"
+               << "esac\n";
+    }
+    chmod(path, 0755);
+
+    Plugin::DeviceDetailsCoprocess coprocess;
+    coprocess.Configure(path, 500, 5, 60000);
+
+    string value;
+    EXPECT_EQ(Core::ERROR_NONE, coprocess.Read(_T("eth_mac"), value));
+    EXPECT_EQ(value, _T("read:eth_mac"));
+    value.clear();
+    EXPECT_EQ(Core::ERROR_GENERAL, coprocess.Read(_T("fail"), value));
+    EXPECT_TRUE(value.empty());
+    EXPECT_EQ(Core::ERROR_TIMEDOUT, coprocess.Read(_T("slow"), value));
+    EXPECT_EQ(Core::ERROR_NONE, coprocess.Read(_T("estb_ip"), value));
+    EXPECT_EQ(value, _T("read:estb_ip"));
+
+    coprocess.Stop();
+    remove(path);
+}
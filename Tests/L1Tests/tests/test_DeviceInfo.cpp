@@ -21,6 +21,7 @@
 
 #include "DeviceInfo.h"
 #include "DeviceInfoImplementation.h"
+#include "NetlinkMonitor.h"
 #include "DeviceAudioCapabilities.h"
 #include "DeviceVideoCapabilities.h"
 #include "AudioOutputPortMock.h"
@@ -38,8 +39,15 @@
 #include "WrapsMock.h"
 #include "ISubSystemMock.h"
 #include "SystemInfo.h"
+#include <condition_variable>
 #include <fstream>
+#include <net/if.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <stdexcept>
 #include "ThunderPortability.h"
+#include "FakeRtnetlink.h"
+#include "FakeSysfs.h"
 
 using namespace WPEFramework;
 
@@ -69,6 +77,9 @@ protected:
     Core::JSONRPC::Handler& handler;
     DECL_CORE_JSONRPC_CONX connection;
     string response;
+    // Private directory holding the stand-in for the vendor getDeviceDetails.sh.
+    string scriptDirectory;
+    string scriptPath;
 
     IarmBusImplMock* p_iarmBusImplMock = nullptr;
     ManagerImplMock* p_managerImplMock = nullptr;
@@ -124,8 +135,16 @@ protected:
         deviceAudioCapabilities = Core::ProxyType<Plugin::DeviceAudioCapabilities>::Create();
         deviceVideoCapabilities = Core::ProxyType<Plugin::DeviceVideoCapabilities>::Create();
 
+        char directory[] = "/tmp/DeviceInfoTestXXXXXX";
+        if (mkdtemp(directory) != nullptr) {
+            scriptDirectory = directory;
+        }
+        scriptPath = scriptDirectory + _T("/getDeviceDetails.sh");
+
+        // Without the background SystemInfo() sampler, so no MFR or subsystem
+        // call happens outside of what a test invokes.
         ON_CALL(service, ConfigLine())
-            .WillByDefault(Return("{\"root\":{\"mode\":\"Off\"}}"));
+            .WillByDefault(Return(_T("{\"root\":{\"mode\":\"Off\"},\"systeminfo\":{\"interval\":0},\"devicedetails\":{\"script\":\"") + scriptPath + _T("\"}}")));
         ON_CALL(service, WebPrefix())
             .WillByDefault(Return(webPrefix));
         ON_CALL(service, SubSystems())
@@ -235,6 +254,31 @@ protected:
             delete p_iarmBusImplMock;
             p_iarmBusImplMock = nullptr;
         }
+
+        RemoveDeviceDetailsScript();
+        if (scriptDirectory.empty() == false) {
+            rmdir(scriptDirectory.c_str());
+        }
+    }
+
+    // Stands in for the vendor getDeviceDetails.sh, which DeviceInfo runs as "<script> read <field>".
+    void InstallDeviceDetailsScript(const string& body)
+    {
+        std::ofstream script(scriptPath);
+        script << "#!/bin/sh\n" << body;
+        script.close();
+        chmod(scriptPath.c_str(), 0755);
+    }
+
+    void RemoveDeviceDetailsScript()
+    {
+        remove(scriptPath.c_str());
+    }
+
+    // Configuration line running the stand-in script, with further "devicedetails" members.
+    string DeviceDetailsConfig(const string& members) const
+    {
+        return (_T("{\"systeminfo\":{\"interval\":0},\"devicedetails\":{\"script\":\"") + scriptPath + _T("\",") + members + _T("}}"));
     }
 };
 
@@ -289,6 +333,171 @@ TEST_F(DeviceInfoTest, SerialNumber_Failure_BothSourcesFail)
     EXPECT_EQ(Core::ERROR_GENERAL, handler.Invoke(connection, _T("serialnumber"), _T(""), response));
 }
 
+TEST_F(DeviceInfoTest, SerialNumber_Success_SkipsUnsupportedMFRType)
+{
+    EXPECT_CALL(*p_iarmBusImplMock, IARM_Bus_Call(_, _, _, _))
+        .Times(1)
+        .WillOnce(Return(IARM_RESULT_INVALID_PARAM));
+
+    EXPECT_CALL(*p_rfcApiImplMock, getRFCParameter(_, _, _))
+        .Times(2)
+        .WillRepeatedly(Invoke(
+            [](char* pcCallerID, const char* pcParameterName, RFC_ParamData_t* pstParamData) {
+                strncpy(pstParamData->value, "RFC12345", sizeof(pstParamData->value));
+                return WDMP_SUCCESS;
+            }));
+
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("serialnumber"), _T(""), response));
+    EXPECT_EQ(response, _T("{\"serialnumber\":\"RFC12345\"}"));
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("serialnumber"), _T(""), response));
+    EXPECT_EQ(response, _T("{\"serialnumber\":\"RFC12345\"}"));
+
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("sourcestatistics"), _T(""), response));
+
+    JsonObject statistics;
+    statistics.FromString(response);
+    ASSERT_TRUE(statistics.HasLabel(_T("sources")));
+
+    JsonObject mfr;
+    JsonObject rfc;
+    const JsonArray sources = statistics[_T("sources")].Array();
+    for (uint16_t index = 0; index < sources.Length(); index++) {
+        const JsonObject entry = sources[index].Object();
+        if (entry[_T("name")].String() == _T("MFR SERIALNUMBER")) {
+            mfr = entry;
+        } else if (entry[_T("name")].String() == _T("RFC Device.DeviceInfo.SerialNumber")) {
+            rfc = entry;
+        }
+    }
+
+    ASSERT_TRUE(mfr.HasLabel(_T("name")));
+    ASSERT_TRUE(rfc.HasLabel(_T("name")));
+    EXPECT_EQ(0, mfr[_T("hits")].Number());
+    EXPECT_EQ(1, mfr[_T("misses")].Number());
+    EXPECT_EQ(1, mfr[_T("skips")].Number());
+    EXPECT_EQ(2, rfc[_T("hits")].Number());
+}
+
+TEST_F(DeviceInfoTest, SerialNumber_Success_RefreshIdentityRetriesUnsupportedMFRType)
+{
+    EXPECT_CALL(*p_iarmBusImplMock, IARM_Bus_Call(_, _, _, _))
+        .Times(2)
+        .WillOnce(Return(IARM_RESULT_INVALID_PARAM))
+        .WillOnce(::testing::Invoke(
+            [](const char* ownerName, const char* methodName, void* arg, size_t argLen) {
+                auto* param = static_cast<IARM_Bus_MFRLib_GetSerializedData_Param_t*>(arg);
+                strncpy(param->buffer, "MFR12345", sizeof(param->buffer) - 1);
+                param->buffer[sizeof(param->buffer) - 1] = '\0';
+                param->bufLen = strlen(param->buffer);
+                return IARM_RESULT_SUCCESS;
+            }));
+
+    EXPECT_CALL(*p_rfcApiImplMock, getRFCParameter(_, _, _))
+        .Times(2)
+        .WillRepeatedly(Invoke(
+            [](char* pcCallerID, const char* pcParameterName, RFC_ParamData_t* pstParamData) {
+                strncpy(pstParamData->value, "RFC12345", sizeof(pstParamData->value));
+                return WDMP_SUCCESS;
+            }));
+
+    // The snapshot is off, so the unsupported MFR type is remembered by the source itself.
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("serialnumber"), _T(""), response));
+    EXPECT_EQ(response, _T("{\"serialnumber\":\"RFC12345\"}"));
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("serialnumber"), _T(""), response));
+    EXPECT_EQ(response, _T("{\"serialnumber\":\"RFC12345\"}"));
+
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("refreshidentity"), _T(""), response));
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("serialnumber"), _T(""), response));
+    EXPECT_EQ(response, _T("{\"serialnumber\":\"MFR12345\"}"));
+}
+
+TEST_F(DeviceInfoTest, SerialNumber_Success_FromIdentitySnapshotUntilRefresh)
+{
+    string serialNumber = _T("SNAP-001");
+
+    EXPECT_CALL(*p_iarmBusImplMock, IARM_Bus_Call(_, _, _, _))
+        .WillRepeatedly(::testing::Invoke(
+            [&serialNumber](const char* ownerName, const char* methodName, void* arg, size_t argLen) {
+                if (methodName && strcmp(methodName, IARM_BUS_MFRLIB_API_GetSerializedData) == 0) {
+                    auto* param = static_cast<IARM_Bus_MFRLib_GetSerializedData_Param_t*>(arg);
+                    if ((param->type == mfrSERIALIZED_TYPE_SERIALNUMBER) && (serialNumber.empty() == false)) {
+                        strncpy(param->buffer, serialNumber.c_str(), sizeof(param->buffer) - 1);
+                        param->buffer[sizeof(param->buffer) - 1] = '\0';
+                        param->bufLen = strlen(param->buffer);
+                        return IARM_RESULT_SUCCESS;
+                    }
+                }
+                return IARM_RESULT_INVALID_PARAM;
+            }));
+
+    ON_CALL(service, ConfigLine())
+        .WillByDefault(Return("{\"root\":{\"mode\":\"Off\"},\"systeminfo\":{\"interval\":0},\"identitysnapshot\":true}"));
+    EXPECT_EQ(Core::ERROR_NONE, deviceInfoImplementation->Configure(&service));
+
+    serialNumber.clear();
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("serialnumber"), _T(""), response));
+    EXPECT_EQ(response, _T("{\"serialnumber\":\"SNAP-001\"}"));
+
+    serialNumber = _T("SNAP-002");
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("serialnumber"), _T(""), response));
+    EXPECT_EQ(response, _T("{\"serialnumber\":\"SNAP-001\"}"));
+
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("refreshidentity"), _T(""), response));
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("serialnumber"), _T(""), response));
+    EXPECT_EQ(response, _T("{\"serialnumber\":\"SNAP-002\"}"));
+}
+
+TEST_F(DeviceInfoTest, SerialNumber_Success_FromMFRPrefetch)
+{
+    std::atomic<uint32_t> serialNumberCalls(0);
+
+    EXPECT_CALL(*p_iarmBusImplMock, IARM_Bus_Call(_, _, _, _))
+        .Times(5)
+        .WillRepeatedly(::testing::Invoke(
+            [&serialNumberCalls](const char* ownerName, const char* methodName, void* arg, size_t argLen) {
+                auto* param = static_cast<IARM_Bus_MFRLib_GetSerializedData_Param_t*>(arg);
+                if (param->type == mfrSERIALIZED_TYPE_SERIALNUMBER) {
+                    serialNumberCalls++;
+                    strncpy(param->buffer, "PREFETCHED01", sizeof(param->buffer) - 1);
+                    param->buffer[sizeof(param->buffer) - 1] = '\0';
+                    param->bufLen = strlen(param->buffer);
+                    return IARM_RESULT_SUCCESS;
+                }
+                return IARM_RESULT_INVALID_PARAM;
+            }));
+
+    ON_CALL(service, ConfigLine())
+        .WillByDefault(Return("{\"systeminfo\":{\"interval\":0},\"mfrprefetch\":3,\"identitysnapshot\":true}"));
+    EXPECT_EQ(Core::ERROR_NONE, deviceInfoImplementation->Configure(&service));
+
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("serialnumber"), _T(""), response));
+    EXPECT_EQ(response, _T("{\"serialnumber\":\"PREFETCHED01\"}"));
+    EXPECT_EQ(1u, serialNumberCalls.load());
+}
+
+TEST_F(DeviceInfoTest, SerialNumber_Success_MFRCircuitOpensAfterFailures)
+{
+    EXPECT_CALL(*p_iarmBusImplMock, IARM_Bus_Call(_, _, _, _))
+        .Times(2)
+        .WillRepeatedly(Return(IARM_RESULT_IPCCORE_FAIL));
+
+    EXPECT_CALL(*p_rfcApiImplMock, getRFCParameter(_, _, _))
+        .WillRepeatedly(Invoke(
+            [](char* pcCallerID, const char* pcParameterName, RFC_ParamData_t* pstParamData) {
+                strncpy(pstParamData->value, "RFC12345", sizeof(pstParamData->value));
+                return WDMP_SUCCESS;
+            }));
+
+    ON_CALL(service, ConfigLine())
+        .WillByDefault(Return("{\"systeminfo\":{\"interval\":0},\"mfr\":{\"failurethreshold\":2,\"opentime\":60000}}"));
+    EXPECT_EQ(Core::ERROR_NONE, deviceInfoImplementation->Configure(&service));
+
+    for (int call = 0; call < 4; call++) {
+        EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("serialnumber"), _T(""), response));
+        EXPECT_EQ(response, _T("{\"serialnumber\":\"RFC12345\"}"));
+    }
+}
+
 TEST_F(DeviceInfoTest, Sku_Success_FromFile)
 {
     std::ofstream file("/etc/device.properties");
@@ -407,6 +616,33 @@ TEST_F(DeviceInfoTest, Model_Success_FromFile)
     EXPECT_EQ(response, _T("{\"model\":\"TestModel123\"}"));
 }
 
+TEST_F(DeviceInfoTest, Model_Success_EmptyProvisionedModelNameIsCached)
+{
+    std::ofstream file("/etc/device.properties");
+    file << "DEVICE_NAME=PLATCO\n";
+    file << "FRIENDLY_ID=FallbackModel\n";
+    file.close();
+
+    EXPECT_CALL(*p_iarmBusImplMock, IARM_Bus_Call(_, _, _, _))
+        .Times(1)
+        .WillOnce(::testing::Invoke(
+            [](const char* ownerName, const char* methodName, void* arg, size_t argLen) {
+                auto* param = static_cast<IARM_Bus_MFRLib_GetSerializedData_Param_t*>(arg);
+                EXPECT_EQ(mfrSERIALIZED_TYPE_PROVISIONED_MODELNAME, param->type);
+                param->bufLen = 0;
+                return IARM_RESULT_SUCCESS;
+            }));
+
+    ON_CALL(service, ConfigLine())
+        .WillByDefault(Return("{\"systeminfo\":{\"interval\":0},\"negativecache\":{\"sources\":[{\"name\":\"MFR PROVISIONED_MODELNAME\",\"expiry\":3600}]}}"));
+    EXPECT_EQ(Core::ERROR_NONE, deviceInfoImplementation->Configure(&service));
+
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("modelname"), _T(""), response));
+    EXPECT_EQ(response, _T("{\"model\":\"FallbackModel\"}"));
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("modelname"), _T(""), response));
+    EXPECT_EQ(response, _T("{\"model\":\"FallbackModel\"}"));
+}
+
 TEST_F(DeviceInfoTest, ReleaseVersion_Success)
 {
     std::ofstream file("/version.txt");
@@ -417,6 +653,27 @@ TEST_F(DeviceInfoTest, ReleaseVersion_Success)
     EXPECT_EQ(response, _T("{\"releaseversion\":\"22.03.0.0\"}"));
 }
 
+TEST_F(DeviceInfoTest, ReleaseVersion_Success_FirstMajorMinorWithSuffix)
+{
+    std::ofstream file("/version.txt");
+    file << "imagename:ABC_1.2_VBN_23.04p_sprint_20230401000000sdy\n";
+    file.close();
+
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("releaseversion"), _T(""), response));
+    EXPECT_EQ(response, _T("{\"releaseversion\":\"23.04.0.0\"}"));
+}
+
+TEST_F(DeviceInfoTest, DeviceType_Success_QuotedWithSpaces)
+{
+    std::ofstream file("/etc/authService.conf");
+    file << "deviceTypeOverride=IpTv\n";
+    file << "deviceType = \"IpStb\"\n";
+    file.close();
+
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("devicetype"), _T(""), response));
+    EXPECT_EQ(response, _T("{\"devicetype\":\"IpStb\"}"));
+}
+
 TEST_F(DeviceInfoTest, ChipSet_Success)
 {
     std::ofstream file("/etc/device.properties");
@@ -427,6 +684,43 @@ TEST_F(DeviceInfoTest, ChipSet_Success)
     EXPECT_EQ(response, _T("{\"chipset\":\"BCM7252S\"}"));
 }
 
+TEST_F(DeviceInfoTest, DeviceProperties_QuotedValues_FirstValidEntryWins)
+{
+    std::ofstream file("/etc/device.properties");
+    file << "SOC = \"BCM7218\"  \n";
+    file << "CHIPSET_NAME=\n";
+    file << "CHIPSET_NAME=\"BCM7252S\"\n";
+    file << "MODEL_NUM_EXT=IGNORED\n";
+    file << "MODEL_NUM=SKU-TEST-002\n";
+    file.close();
+
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("socname"), _T(""), response));
+    EXPECT_EQ(response, _T("{\"socname\":\"BCM7218\"}"));
+
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("chipset"), _T(""), response));
+    EXPECT_EQ(response, _T("{\"chipset\":\"BCM7252S\"}"));
+
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("modelid"), _T(""), response));
+    EXPECT_EQ(response, _T("{\"sku\":\"SKU-TEST-002\"}"));
+}
+
+TEST_F(DeviceInfoTest, DeviceProperties_ReloadedAfterRewrite)
+{
+    std::ofstream file("/etc/device.properties");
+    file << "SOC=BCM7218\n";
+    file.close();
+
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("socname"), _T(""), response));
+    EXPECT_EQ(response, _T("{\"socname\":\"BCM7218\"}"));
+
+    file.open("/etc/device.properties", std::ios::trunc);
+    file << "SOC=BCM72180\n";
+    file.close();
+
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("socname"), _T(""), response));
+    EXPECT_EQ(response, _T("{\"socname\":\"BCM72180\"}"));
+}
+
 TEST_F(DeviceInfoTest, FirmwareVersion_Success)
 {
     std::ofstream file("/version.txt");
@@ -455,6 +749,33 @@ TEST_F(DeviceInfoTest, FirmwareVersion_Success)
     EXPECT_EQ(response, _T("{\"imagename\":\"TEST_IMAGE_V1\",\"sdk\":\"18.4\",\"mediarite\":\"9.0.1\",\"yocto\":\"dunfell\",\"pdri\":\"PDRI_1.2.3\"}"));
 }
 
+TEST_F(DeviceInfoTest, FirmwareVersion_Success_SharedParseFollowsRewrite)
+{
+    std::ofstream file("/version.txt");
+    file << "YOCTO_VERSION=kirkstone\n";
+    file << "imagename:FIRST_IMAGE_23.04s\n";
+    file << "SDK_VERSION=17.3\n";
+    file.close();
+
+    EXPECT_CALL(*p_iarmBusImplMock, IARM_Bus_Call(_, _, _, _))
+        .WillRepeatedly(Return(IARM_RESULT_INVALID_PARAM));
+
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("firmwareversion"), _T(""), response));
+    EXPECT_EQ(response, _T("{\"imagename\":\"FIRST_IMAGE_23.04s\",\"sdk\":\"17.3\",\"mediarite\":\"\",\"yocto\":\"kirkstone\",\"pdri\":\"\"}"));
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("releaseversion"), _T(""), response));
+    EXPECT_EQ(response, _T("{\"releaseversion\":\"23.04.0.0\"}"));
+
+    std::ofstream rewritten("/version.txt", std::ios::trunc);
+    rewritten << "imagename:SECOND_IMAGE_24.01p\n";
+    rewritten << "MEDIARITE=10.1\n";
+    rewritten.close();
+
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("firmwareversion"), _T(""), response));
+    EXPECT_EQ(response, _T("{\"imagename\":\"SECOND_IMAGE_24.01p\",\"sdk\":\"\",\"mediarite\":\"10.1\",\"yocto\":\"\",\"pdri\":\"\"}"));
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("releaseversion"), _T(""), response));
+    EXPECT_EQ(response, _T("{\"releaseversion\":\"24.01.0.0\"}"));
+}
+
 TEST_F(DeviceInfoTest, Sku_Success_FromMFR)
 {
     // Ensure file doesn't exist before calling implementation
@@ -582,6 +903,23 @@ TEST_F(DeviceInfoTest, DistributorId_Success_FromFile)
     EXPECT_EQ(response, _T("{\"distributorid\":\"PARTNER123\"}"));
 }
 
+TEST_F(DeviceInfoTest, DistributorId_Success_RewrittenAtRuntime)
+{
+    std::ofstream file("/opt/www/authService/partnerId3.dat");
+    file << "PARTNER123\n";
+    file.close();
+
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("distributorid"), _T(""), response));
+    EXPECT_EQ(response, _T("{\"distributorid\":\"PARTNER123\"}"));
+
+    file.open("/opt/www/authService/partnerId3.dat", std::ios::trunc);
+    file << "PARTNER789\n";
+    file.close();
+
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("distributorid"), _T(""), response));
+    EXPECT_EQ(response, _T("{\"distributorid\":\"PARTNER789\"}"));
+}
+
 TEST_F(DeviceInfoTest, DistributorId_Success_FromRFC)
 {
     removeFile("/opt/www/authService/partnerId3.dat");
@@ -739,6 +1077,100 @@ TEST_F(DeviceInfoTest, DISABLE_SystemInfo_Success)
     EXPECT_TRUE(response.find("\"time\":") != string::npos);
 }
 
+TEST_F(DeviceInfoTest, SystemInfo_Success_ServedFromSampler)
+{
+    std::atomic<uint32_t> serialReads(0);
+
+    EXPECT_CALL(*p_iarmBusImplMock, IARM_Bus_Call(_, _, _, _))
+        .WillRepeatedly(::testing::Invoke(
+            [&serialReads](const char* ownerName, const char* methodName, void* arg, size_t argLen) {
+                if (methodName && strcmp(methodName, IARM_BUS_MFRLIB_API_GetSerializedData) == 0) {
+                    auto* param = static_cast<IARM_Bus_MFRLib_GetSerializedData_Param_t*>(arg);
+                    if (param->type == mfrSERIALIZED_TYPE_SERIALNUMBER) {
+                        serialReads++;
+                        strncpy(param->buffer, "SAMPLED123", sizeof(param->buffer) - 1);
+                        param->buffer[sizeof(param->buffer) - 1] = '\0';
+                        param->bufLen = strlen(param->buffer);
+                        return IARM_RESULT_SUCCESS;
+                    }
+                }
+                return IARM_RESULT_INVALID_PARAM;
+            }));
+
+    // Long enough that only the sample taken by Configure exists during the test.
+    ON_CALL(service, ConfigLine())
+        .WillByDefault(Return("{\"systeminfo\":{\"interval\":60000}}"));
+    EXPECT_EQ(Core::ERROR_NONE, deviceInfoImplementation->Configure(&service));
+
+    const uint32_t reads = serialReads;
+    EXPECT_GE(reads, 1u);
+
+    Exchange::IDeviceInfo::SystemInfos info{};
+    EXPECT_EQ(Core::ERROR_NONE, deviceInfoImplementation->SystemInfo(info));
+    EXPECT_EQ(info.serialnumber, _T("SAMPLED123"));
+    EXPECT_FALSE(info.totalram == 0);
+    EXPECT_FALSE(info.time.empty());
+    EXPECT_EQ(Core::ERROR_NONE, deviceInfoImplementation->SystemInfo(info));
+    EXPECT_EQ(info.serialnumber, _T("SAMPLED123"));
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("systeminfofields"), _T("{\"fields\":[\"serialnumber\"]}"), response));
+    EXPECT_EQ(response, _T("{\"serialnumber\":\"SAMPLED123\"}"));
+
+    // None of the calls went to the backends.
+    EXPECT_EQ(reads, serialReads.load());
+}
+
+namespace {
+
+    // Collects the ESTB IPs the implementation reports.
+    class EstbIpChanges : public Exchange::IDeviceInfoExtended::INotification {
+    public:
+        EstbIpChanges(const EstbIpChanges&) = delete;
+        EstbIpChanges& operator=(const EstbIpChanges&) = delete;
+
+        EstbIpChanges() = default;
+        ~EstbIpChanges() override = default;
+
+        void EstbIpChanged(const string& ip) override
+        {
+            std::lock_guard<std::mutex> guard(_lock);
+            _ips.push_back(ip);
+            _reported.notify_all();
+        }
+
+        // The next reported IP, or "none" when nothing is reported within a few seconds.
+        string Next()
+        {
+            std::unique_lock<std::mutex> guard(_lock);
+            if (_reported.wait_for(guard, std::chrono::seconds(5), [this]() { return (_ips.empty() == false); }) == false) {
+                return (_T("none"));
+            }
+            const string ip = _ips.front();
+            _ips.pop_front();
+            return (ip);
+        }
+
+        BEGIN_INTERFACE_MAP(EstbIpChanges)
+        INTERFACE_ENTRY(Exchange::IDeviceInfoExtended::INotification)
+        END_INTERFACE_MAP
+
+    private:
+        std::mutex _lock;
+        std::condition_variable _reported;
+        std::list<string> _ips;
+    };
+
+    // eth0 with an IPv4 and a link-local IPv6 address, and lo, which the filters below leave out.
+    void FakeInterfaces(FakeRtnetlink& kernel)
+    {
+        kernel.Link(1, _T("lo"), { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, IFF_UP | IFF_LOOPBACK);
+        kernel.Address(1, AF_INET, _T("127.0.0.1"), 8, RT_SCOPE_HOST);
+        kernel.Link(2, _T("eth0"), { 0x00, 0x11, 0x22, 0xaa, 0xbb, 0xcc }, IFF_UP | IFF_RUNNING);
+        kernel.Address(2, AF_INET, _T("192.168.1.20"), 24, RT_SCOPE_UNIVERSE);
+        kernel.Address(2, AF_INET6, _T("fe80::211:22ff:feaa:bbcc"), 64, RT_SCOPE_LINK);
+    }
+
+}
+
 TEST_F(DeviceInfoTest, Addresses_Success)
 {
     EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("addresses"), _T(""), response));
@@ -746,6 +1178,262 @@ TEST_F(DeviceInfoTest, Addresses_Success)
     EXPECT_TRUE(response.find("\"mac\":") != string::npos);
 }
 
+TEST_F(DeviceInfoTest, Addresses_Success_ListsEveryInterfaceOfTheDump)
+{
+    std::list<Plugin::NetlinkMonitor::Link> links;
+    ASSERT_EQ(Core::ERROR_NONE, Plugin::NetlinkMonitor::Dump(links));
+
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("addresses"), _T(""), response));
+    for (const Plugin::NetlinkMonitor::Link& link : links) {
+        EXPECT_TRUE(response.find("\"name\":\"" + link.name + "\"") != string::npos);
+    }
+}
+
+TEST_F(DeviceInfoTest, NetworkAddresses_Success_ListsPrefixAndScope)
+{
+    FakeRtnetlink kernel;
+    FakeInterfaces(kernel);
+    ASSERT_EQ(Core::ERROR_NONE, deviceInfoImplementation->Netlink(kernel.Socket()));
+
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("networkaddresses"), _T(""), response));
+    EXPECT_EQ(response, string("{\"interfaces\":["
+                               "{\"name\":\"lo\",\"mac\":\"00:00:00:00:00:00\",\"addresses\":["
+                               "{\"address\":\"127.0.0.1\",\"family\":\"ipv4\",\"prefix\":8,\"scope\":\"host\"}]},"
+                               "{\"name\":\"eth0\",\"mac\":\"00:11:22:aa:bb:cc\",\"addresses\":["
+                               "{\"address\":\"192.168.1.20\",\"family\":\"ipv4\",\"prefix\":24,\"scope\":\"global\"},"
+                               "{\"address\":\"fe80::211:22ff:feaa:bbcc\",\"family\":\"ipv6\",\"prefix\":64,\"scope\":\"link\"}]}]}"));
+}
+
+TEST_F(DeviceInfoTest, Addresses_Success_ConfiguredFilterSelectsInterfaces)
+{
+    FakeRtnetlink kernel;
+    FakeInterfaces(kernel);
+    kernel.Link(3, _T("eth1"), { 0x00, 0x11, 0x22, 0xaa, 0xbb, 0xcd }, IFF_UP);
+    kernel.Address(3, AF_INET6, _T("2001:db8::21"), 64, RT_SCOPE_UNIVERSE);
+
+    ON_CALL(service, ConfigLine())
+        .WillByDefault(Return("{\"systeminfo\":{\"interval\":0},\"addresses\":{\"interfaces\":\"eth?\",\"family\":\"ipv4\",\"hasaddress\":true}}"));
+    EXPECT_EQ(Core::ERROR_NONE, deviceInfoImplementation->Configure(&service));
+    ASSERT_EQ(Core::ERROR_NONE, deviceInfoImplementation->Netlink(kernel.Socket()));
+
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("addresses"), _T(""), response));
+    EXPECT_TRUE(response.find("\"name\":\"eth0\"") != string::npos);
+    EXPECT_TRUE(response.find("\"ip\":\"192.168.1.20\"") != string::npos);
+    EXPECT_EQ(response.find("\"name\":"), response.rfind("\"name\":"));
+}
+
+TEST_F(DeviceInfoTest, NetworkAddresses_Success_FilteredByNameAndFamily)
+{
+    FakeRtnetlink kernel;
+    FakeInterfaces(kernel);
+    ASSERT_EQ(Core::ERROR_NONE, deviceInfoImplementation->Netlink(kernel.Socket()));
+
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("networkaddresses"), _T("{\"interfaces\":\"lo\",\"family\":\"ipv4\"}"), response));
+    EXPECT_EQ(response, string("{\"interfaces\":[{\"name\":\"lo\",\"mac\":\"00:00:00:00:00:00\",\"addresses\":[{\"address\":\"127.0.0.1\",\"family\":\"ipv4\",\"prefix\":8,\"scope\":\"host\"}]}]}"));
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("networkaddresses"), _T("{\"interfaces\":\"eth*\",\"family\":\"ipv6\"}"), response));
+    EXPECT_EQ(response, string("{\"interfaces\":[{\"name\":\"eth0\",\"mac\":\"00:11:22:aa:bb:cc\",\"addresses\":[{\"address\":\"fe80::211:22ff:feaa:bbcc\",\"family\":\"ipv6\",\"prefix\":64,\"scope\":\"link\"}]}]}"));
+}
+
+TEST_F(DeviceInfoTest, NetworkAddresses_Failure_UnknownFamily)
+{
+    EXPECT_EQ(Core::ERROR_BAD_REQUEST, handler.Invoke(connection, _T("networkaddresses"), _T("{\"family\":\"ipx\"}"), response));
+}
+
+TEST_F(DeviceInfoTest, SystemInfoHistory_Failure_NotConfigured)
+{
+    EXPECT_EQ(Core::ERROR_UNAVAILABLE, handler.Invoke(connection, _T("systeminfohistory"), _T("{\"window\":60}"), response));
+}
+
+TEST_F(DeviceInfoTest, SystemInfoHistory_Success_FedBySampler)
+{
+    // Long enough that only the sample taken by Configure exists during the test.
+    ON_CALL(service, ConfigLine())
+        .WillByDefault(Return("{\"systeminfo\":{\"interval\":60000,\"history\":5}}"));
+    EXPECT_EQ(Core::ERROR_NONE, deviceInfoImplementation->Configure(&service));
+
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("systeminfohistory"), _T("{\"window\":60}"), response));
+    EXPECT_TRUE(response.find("\"cpuload\":") != string::npos);
+    EXPECT_TRUE(response.find("\"freeram\":") != string::npos);
+    EXPECT_EQ(response.find("\"time\":"), response.rfind("\"time\":"));
+}
+
+TEST_F(DeviceInfoTest, SystemInfoFields_Success_OnlyRequestedMembers)
+{
+    EXPECT_CALL(*p_iarmBusImplMock, IARM_Bus_Call(_, _, _, _))
+        .WillRepeatedly(::testing::Invoke(
+            [](const char* ownerName, const char* methodName, void* arg, size_t argLen) {
+                if (methodName && strcmp(methodName, IARM_BUS_MFRLIB_API_GetSerializedData) == 0) {
+                    auto* param = static_cast<IARM_Bus_MFRLib_GetSerializedData_Param_t*>(arg);
+                    if (param->type == mfrSERIALIZED_TYPE_SERIALNUMBER) {
+                        strncpy(param->buffer, "TEST12345", sizeof(param->buffer) - 1);
+                        param->buffer[sizeof(param->buffer) - 1] = '\0';
+                        param->bufLen = strlen(param->buffer);
+                        return IARM_RESULT_SUCCESS;
+                    }
+                }
+                return IARM_RESULT_INVALID_PARAM;
+            }));
+
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("systeminfofields"), _T("{\"fields\":[\"serialnumber\"]}"), response));
+    EXPECT_EQ(response, _T("{\"serialnumber\":\"TEST12345\"}"));
+}
+
+TEST_F(DeviceInfoTest, SystemInfoFields_Success_SkipsSerialNumberLookup)
+{
+    EXPECT_CALL(*p_iarmBusImplMock, IARM_Bus_Call(_, _, _, _))
+        .Times(0);
+
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("systeminfofields"), _T("{\"fields\":[\"time\"]}"), response));
+    EXPECT_TRUE(response.find("\"time\":") != string::npos);
+    EXPECT_TRUE(response.find("serialnumber") == string::npos);
+}
+
+TEST_F(DeviceInfoTest, SystemInfoFields_Success_ReportsExtraMeminfoFields)
+{
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("systeminfofields"), _T("{\"fields\":[\"availableram\",\"cachedram\",\"cmafree\"]}"), response));
+    EXPECT_TRUE(response.find("\"availableram\":") != string::npos);
+    EXPECT_TRUE(response.find("\"cachedram\":") != string::npos);
+    EXPECT_TRUE(response.find("\"cmafree\":") != string::npos);
+    EXPECT_TRUE(response.find("freeram") == string::npos);
+}
+
+TEST_F(DeviceInfoTest, SystemInfoFields_Failure_UnknownField)
+{
+    EXPECT_EQ(Core::ERROR_BAD_REQUEST, handler.Invoke(connection, _T("systeminfofields"), _T("{\"fields\":[\"cpuload\",\"battery\"]}"), response));
+}
+
+TEST_F(DeviceInfoTest, SystemInfoFields_Failure_FieldsNotAnArrayOfNames)
+{
+    // None of these may fall back to every field, and so to the MFR serial number lookup.
+    EXPECT_CALL(*p_iarmBusImplMock, IARM_Bus_Call(_, _, _, _))
+        .Times(0);
+
+    EXPECT_EQ(Core::ERROR_BAD_REQUEST, handler.Invoke(connection, _T("systeminfofields"), _T("{\"fields\":\"cpuload\"}"), response));
+    EXPECT_EQ(Core::ERROR_BAD_REQUEST, handler.Invoke(connection, _T("systeminfofields"), _T("{\"fields\":[\"cpuload\",42]}"), response));
+
+    string info;
+    EXPECT_EQ(Core::ERROR_BAD_REQUEST, deviceInfoImplementation->SystemInfoFields(_T("cpuload"), info));
+    EXPECT_TRUE(info.empty());
+}
+
+TEST_F(DeviceInfoTest, MemoryPressure_Success_ReportsHostRollup)
+{
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("memorypressure"), _T(""), response));
+    EXPECT_TRUE(response.find("\"host\":{\"pid\":" + std::to_string(getpid())) != string::npos);
+    EXPECT_TRUE(response.find("\"pss\":") != string::npos);
+    // The implementation runs in the test process, so it is not reported separately.
+    EXPECT_TRUE(response.find("\"implementation\"") == string::npos);
+}
+
+TEST_F(DeviceInfoTest, MemoryPressure_Success_ReportsImplementationOutsideTheHost)
+{
+    string pressure;
+
+    EXPECT_EQ(Core::ERROR_NONE, deviceInfoImplementation->MemoryPressure(static_cast<uint32_t>(getppid()), pressure));
+    EXPECT_TRUE(pressure.find("\"implementation\":{\"pid\":" + std::to_string(getpid())) != string::npos);
+}
+
+TEST_F(DeviceInfoTest, ThermalInfo_Success_ReportsZonesCoolingDevicesAndCpus)
+{
+    FakeSysfs sysfs;
+    sysfs.Write(_T("thermal/thermal_zone0/type"), _T("cpu-thermal"));
+    sysfs.Write(_T("thermal/thermal_zone0/temp"), _T("-5000"));
+    sysfs.Write(_T("thermal/cooling_device0/type"), _T("fan"));
+    sysfs.Write(_T("thermal/cooling_device0/cur_state"), _T("1"));
+    sysfs.Write(_T("thermal/cooling_device0/max_state"), _T("3"));
+    sysfs.Write(_T("thermal/cooling_device0/stats/total_trans"), _T("5"));
+    sysfs.Write(_T("cpu/cpu0/cpufreq/scaling_cur_freq"), _T("1200000"));
+    sysfs.Write(_T("cpu/cpu0/cpufreq/cpuinfo_max_freq"), _T("1800000"));
+
+    ON_CALL(service, ConfigLine())
+        .WillByDefault(Return("{\"systeminfo\":{\"interval\":0},\"thermal\":{\"thermalclass\":\"" + sysfs.Thermal() + "\",\"cpudevices\":\"" + sysfs.Cpus() + "\"}}"));
+    EXPECT_EQ(Core::ERROR_NONE, deviceInfoImplementation->Configure(&service));
+
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("thermalinfo"), _T(""), response));
+    EXPECT_EQ(0u, response.find(_T("{\"zones\":[{\"name\":\"cpu-thermal\",\"temperature\":-5000}],"
+                                   "\"coolingdevices\":[{\"name\":\"fan\",\"state\":1,\"maxstate\":3,\"transitions\":5}],"
+                                   "\"cpus\":[{\"cpu\":0,\"frequency\":1200000,\"maxfrequency\":1800000}],"
+                                   "\"time\":")));
+
+    // Read on the spot while the sampler is off.
+    sysfs.Write(_T("thermal/thermal_zone0/temp"), _T("61000"));
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("thermalinfo"), _T(""), response));
+    EXPECT_TRUE(response.find(_T("\"temperature\":61000")) != string::npos);
+}
+
+TEST_F(DeviceInfoTest, ThermalInfo_Failure_NothingExported)
+{
+    FakeSysfs sysfs;
+    sysfs.Write(_T("thermal/thermal_zone0/type"), _T("no-temp"));
+
+    ON_CALL(service, ConfigLine())
+        .WillByDefault(Return("{\"systeminfo\":{\"interval\":0},\"thermal\":{\"thermalclass\":\"" + sysfs.Thermal() + "\",\"cpudevices\":\"" + sysfs.Cpus() + "\"}}"));
+    EXPECT_EQ(Core::ERROR_NONE, deviceInfoImplementation->Configure(&service));
+
+    EXPECT_EQ(Core::ERROR_UNAVAILABLE, handler.Invoke(connection, _T("thermalinfo"), _T(""), response));
+}
+
+TEST_F(DeviceInfoTest, Addresses_Success_NetlinkModeServesLiveModel)
+{
+    FakeRtnetlink kernel;
+    FakeInterfaces(kernel);
+
+    ON_CALL(service, ConfigLine())
+        .WillByDefault(Return("{\"systeminfo\":{\"interval\":0},\"devicedetails\":{\"mode\":\"netlink\",\"ethernet\":\"eth0\",\"estb\":\"eth0\"}}"));
+    EXPECT_EQ(Core::ERROR_NONE, deviceInfoImplementation->Configure(&service));
+    ASSERT_EQ(Core::ERROR_NONE, deviceInfoImplementation->Netlink(kernel.Socket()));
+
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("addresses"), _T(""), response));
+    EXPECT_TRUE(response.find("\"name\":\"eth0\"") != string::npos);
+    EXPECT_TRUE(response.find("\"ip\":\"192.168.1.20\"") != string::npos);
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("ethmac"), _T(""), response));
+    EXPECT_EQ(response, string("{\"eth_mac\":\"00:11:22:AA:BB:CC\"}"));
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("estbip"), _T(""), response));
+    EXPECT_EQ(response, string("{\"estb_ip\":\"192.168.1.20\"}"));
+}
+
+TEST_F(DeviceInfoTest, EstbIpChanged_Success_ReportedFromNetlinkEvents)
+{
+    FakeRtnetlink kernel;
+    FakeInterfaces(kernel);
+    Core::Sink<EstbIpChanges> changes;
+
+    ON_CALL(service, ConfigLine())
+        .WillByDefault(Return("{\"systeminfo\":{\"interval\":0},\"devicedetails\":{\"mode\":\"netlink\",\"ethernet\":\"eth0\",\"estb\":\"eth0\"}}"));
+    EXPECT_EQ(Core::ERROR_NONE, deviceInfoImplementation->Configure(&service));
+    ASSERT_EQ(Core::ERROR_NONE, deviceInfoImplementation->Netlink(kernel.Socket()));
+    EXPECT_EQ(Core::ERROR_NONE, deviceInfoImplementation->Register(&changes));
+
+    // Another interface changing is not reported.
+    kernel.AddressEvent(RTM_NEWADDR, 1, AF_INET, _T("127.0.0.2"), 8, RT_SCOPE_HOST);
+    kernel.AddressEvent(RTM_DELADDR, 2, AF_INET, _T("192.168.1.20"), 24, RT_SCOPE_UNIVERSE);
+    EXPECT_EQ(changes.Next(), string());
+    kernel.AddressEvent(RTM_NEWADDR, 2, AF_INET, _T("192.168.1.21"), 24, RT_SCOPE_UNIVERSE);
+    EXPECT_EQ(changes.Next(), string(_T("192.168.1.21")));
+
+    EXPECT_EQ(Core::ERROR_NONE, deviceInfoImplementation->Unregister(&changes));
+}
+
+TEST_F(DeviceInfoTest, NetworkAddresses_Success_NetlinkModeServesLiveModel)
+{
+    FakeRtnetlink kernel;
+    FakeInterfaces(kernel);
+
+    ON_CALL(service, ConfigLine())
+        .WillByDefault(Return("{\"systeminfo\":{\"interval\":0},\"devicedetails\":{\"mode\":\"netlink\",\"ethernet\":\"eth0\",\"estb\":\"eth0\"}}"));
+    EXPECT_EQ(Core::ERROR_NONE, deviceInfoImplementation->Configure(&service));
+    ASSERT_EQ(Core::ERROR_NONE, deviceInfoImplementation->Netlink(kernel.Socket()));
+
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("networkaddresses"), _T("{\"interfaces\":\"eth*\"}"), response));
+    EXPECT_EQ(response, string("{\"interfaces\":[{\"name\":\"eth0\",\"mac\":\"00:11:22:aa:bb:cc\",\"addresses\":["
+                               "{\"address\":\"192.168.1.20\",\"family\":\"ipv4\",\"prefix\":24,\"scope\":\"global\"},"
+                               "{\"address\":\"fe80::211:22ff:feaa:bbcc\",\"family\":\"ipv6\",\"prefix\":64,\"scope\":\"link\"}]}]}"));
+
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("networkaddresses"), _T("{\"family\":\"ipv6\",\"hasaddress\":true}"), response));
+    EXPECT_EQ(response, string("{\"interfaces\":[{\"name\":\"eth0\",\"mac\":\"00:11:22:aa:bb:cc\",\"addresses\":["
+                               "{\"address\":\"fe80::211:22ff:feaa:bbcc\",\"family\":\"ipv6\",\"prefix\":64,\"scope\":\"link\"}]}]}"));
+}
+
 TEST_F(DeviceInfoTest, SupportedAudioPorts_Success)
 {
     device::List<device::AudioOutputPort> audioPorts;
@@ -769,6 +1457,78 @@ TEST_F(DeviceInfoTest, SupportedAudioPorts_Success)
     EXPECT_TRUE(response.find("\"success\":true") != string::npos);
 }
 
+TEST_F(DeviceInfoTest, AudioCapabilityMatrix_Success_AllPortsInOneCall)
+{
+    device::List<device::AudioOutputPort> audioPorts;
+    device::AudioOutputPort port;
+    static const string portName = "HDMI0";
+
+    ON_CALL(*p_audioOutputPortMock, getName())
+        .WillByDefault(ReturnRef(portName));
+    EXPECT_CALL(*p_hostImplMock, getAudioOutputPorts())
+        .WillOnce(Invoke([&]() {
+            audioPorts.push_back(port);
+            return audioPorts;
+        }));
+    // One port lookup and one call per getter fill all three answers of the port.
+    EXPECT_CALL(*p_hostImplMock, getAudioOutputPort(portName))
+        .Times(1)
+        .WillOnce(ReturnRef(port));
+    EXPECT_CALL(*p_audioOutputPortMock, getAudioCapabilities(::testing::_))
+        .Times(1)
+        .WillOnce(Invoke([](int* capabilities) { *capabilities = dsAUDIOSUPPORT_ATMOS | dsAUDIOSUPPORT_DD; }));
+    EXPECT_CALL(*p_audioOutputPortMock, getMS12Capabilities(::testing::_))
+        .Times(1)
+        .WillOnce(Invoke([](int* capabilities) { *capabilities = dsMS12SUPPORT_DolbyVolume; }));
+    EXPECT_CALL(*p_audioOutputPortMock, getMS12AudioProfileList())
+        .Times(1)
+        .WillOnce(Return(std::vector<std::string>({ "Movie" })));
+
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("audiocapabilitymatrix"), _T(""), response));
+    EXPECT_TRUE(response.find("\"name\":\"HDMI0\"") != string::npos);
+    EXPECT_TRUE(response.find("\"ATMOS\"") != string::npos);
+    EXPECT_TRUE(response.find("\"audiomask\":") != string::npos);
+    EXPECT_TRUE(response.find("\"ms12mask\":") != string::npos);
+    EXPECT_TRUE(response.find("\"ms12profiles\":[\"Movie\"]") != string::npos);
+    EXPECT_TRUE(response.find("\"success\":true") != string::npos);
+}
+
+TEST_F(DeviceInfoTest, AudioCapabilityMatrix_Success_PortFlagsFailedQuery)
+{
+    device::List<device::AudioOutputPort> audioPorts;
+    device::AudioOutputPort port;
+    static const string portName = "HDMI0";
+
+    ON_CALL(*p_audioOutputPortMock, getName())
+        .WillByDefault(ReturnRef(portName));
+    EXPECT_CALL(*p_hostImplMock, getAudioOutputPorts())
+        .WillOnce(Invoke([&]() {
+            audioPorts.push_back(port);
+            return audioPorts;
+        }));
+    // The failed MS12 query is retried on its own for ms12capabilities.
+    EXPECT_CALL(*p_hostImplMock, getAudioOutputPort(portName))
+        .Times(2)
+        .WillRepeatedly(ReturnRef(port));
+    EXPECT_CALL(*p_audioOutputPortMock, getAudioCapabilities(::testing::_))
+        .Times(1)
+        .WillOnce(Invoke([](int* capabilities) { *capabilities = dsAUDIOSUPPORT_DD; }));
+    EXPECT_CALL(*p_audioOutputPortMock, getMS12Capabilities(::testing::_))
+        .Times(2)
+        .WillRepeatedly(Invoke([](int*) { throw device::Exception("Test exception"); }));
+    EXPECT_CALL(*p_audioOutputPortMock, getMS12AudioProfileList())
+        .Times(1)
+        .WillOnce(Return(std::vector<std::string>({ "Movie" })));
+
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("audiocapabilitymatrix"), _T(""), response));
+    EXPECT_TRUE(response.find("\"name\":\"HDMI0\"") != string::npos);
+    EXPECT_TRUE(response.find("\"DOLBY_DIGITAL\"") != string::npos);
+    EXPECT_TRUE(response.find("\"ms12profiles\":[\"Movie\"]") != string::npos);
+    EXPECT_TRUE(response.find("\"ms12capabilities\"") == string::npos);
+    EXPECT_TRUE(response.find("\"ms12mask\"") == string::npos);
+    EXPECT_TRUE(response.find("\"success\":false") != string::npos);
+}
+
 TEST_F(DeviceInfoTest, SupportedAudioPorts_Exception_DeviceException)
 {
     EXPECT_CALL(*p_hostImplMock, getAudioOutputPorts())
@@ -1366,250 +2126,246 @@ TEST_F(DeviceInfoTest, EdgeCase_MultipleIARMCallsSequential)
 
 TEST_F(DeviceInfoTest, EthMac_Success)
 {
-    EXPECT_CALL(*p_wrapsImplMock, v_secure_popen(::testing::_, ::testing::_, ::testing::_))
-        .Times(1)
-        .WillOnce(::testing::Invoke(
-            [&](const char* direction, const char* command, va_list args) {
-                va_list args2;
-                va_copy(args2, args);
-                char strFmt[256];
-                vsnprintf(strFmt, sizeof(strFmt), command, args2);
-                va_end(args2);
-                EXPECT_EQ(string(strFmt), string("/lib/rdk/getDeviceDetails.sh read eth_mac"));
-
-                const char mac[] = "AA:BB:CC:DD:EE:FF\n";
-                FILE* pipe = fmemopen((void*)mac, sizeof(mac) - 1, "r");
-                return pipe;
-            }));
-
-    EXPECT_CALL(*p_wrapsImplMock, v_secure_pclose(::testing::_))
-        .Times(1)
-        .WillOnce(::testing::Return(0));
+    InstallDeviceDetailsScript("case \"$1 $2\" in \"read eth_mac\") echo \"AA:BB:CC:DD:EE:FF\" ;; *) exit 1 ;; esac\n");
 
     EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("ethmac"), _T(""), response));
     EXPECT_EQ(response, string("{\"eth_mac\":\"AA:BB:CC:DD:EE:FF\"}"));
+
+    RemoveDeviceDetailsScript();
 }
 
-TEST_F(DeviceInfoTest, EthMac_Failure_PopenReturnsNull)
+TEST_F(DeviceInfoTest, EthMac_Failure_ScriptMissing)
 {
-    EXPECT_CALL(*p_wrapsImplMock, v_secure_popen(::testing::_, ::testing::_, ::testing::_))
-        .Times(1)
-        .WillOnce(::testing::Return(nullptr));
+    RemoveDeviceDetailsScript();
 
     EXPECT_EQ(Core::ERROR_GENERAL, handler.Invoke(connection, _T("ethmac"), _T(""), response));
 }
 
 TEST_F(DeviceInfoTest, EthMac_Success_NewlineStripped)
 {
-    EXPECT_CALL(*p_wrapsImplMock, v_secure_popen(::testing::_, ::testing::_, ::testing::_))
-        .Times(1)
-        .WillOnce(::testing::Invoke(
-            [&](const char* direction, const char* command, va_list args) {
-                const char mac[] = "11:22:33:44:55:66\n";
-                char buffer[256];
-                strncpy(buffer, mac, sizeof(buffer) - 1);
-                return fmemopen(buffer, strlen(buffer), "r");
-            }));
-
-    EXPECT_CALL(*p_wrapsImplMock, v_secure_pclose(::testing::_))
-        .Times(1)
-        .WillOnce(::testing::Return(0));
+    InstallDeviceDetailsScript("printf '11:22:33:44:55:66\\n'\n");
 
     EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("ethmac"), _T(""), response));
     // Verify newline is stripped - should not end with \n in JSON
     EXPECT_EQ(response, string("{\"eth_mac\":\"11:22:33:44:55:66\"}"));
+
+    RemoveDeviceDetailsScript();
 }
 
 TEST_F(DeviceInfoTest, EthMac_Success_EmptyOutput)
 {
-    EXPECT_CALL(*p_wrapsImplMock, v_secure_popen(::testing::_, ::testing::_, ::testing::_))
-        .Times(1)
-        .WillOnce(::testing::Invoke(
-            [&](const char* direction, const char* command, va_list args) {
-                char buffer[1] = {0};
-                return fmemopen(buffer, 0, "r");
-            }));
-
-    EXPECT_CALL(*p_wrapsImplMock, v_secure_pclose(::testing::_))
-        .Times(1)
-        .WillOnce(::testing::Return(0));
+    InstallDeviceDetailsScript("exit 0\n");
 
     EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("ethmac"), _T(""), response));
     EXPECT_EQ(response, string("{\"eth_mac\":\"\"}"));
+
+    RemoveDeviceDetailsScript();
 }
 
-TEST_F(DeviceInfoTest, EstbMac_Success)
+TEST_F(DeviceInfoTest, EthMac_Failure_ScriptExitsNonZero)
 {
-    EXPECT_CALL(*p_wrapsImplMock, v_secure_popen(::testing::_, ::testing::_, ::testing::_))
-        .Times(1)
-        .WillOnce(::testing::Invoke(
-            [&](const char* direction, const char* command, va_list args) {
-                va_list args2;
-                va_copy(args2, args);
-                char strFmt[256];
-                vsnprintf(strFmt, sizeof(strFmt), command, args2);
-                va_end(args2);
-                EXPECT_EQ(string(strFmt), string("/lib/rdk/getDeviceDetails.sh read estb_mac"));
-
-                const char mac[] = "11:22:33:44:55:66\n";
-                char buffer[256];
-                memset(buffer, 0, sizeof(buffer));
-                strncpy(buffer, mac, sizeof(buffer) - 1);
-                FILE* pipe = fmemopen(buffer, strlen(buffer), "r");
-                return pipe;
-            }));
+    InstallDeviceDetailsScript("echo \"AA:BB:CC:DD:EE:FF\"\nexit 2\n");
 
-    EXPECT_CALL(*p_wrapsImplMock, v_secure_pclose(::testing::_))
-        .Times(1)
-        .WillOnce(::testing::Return(0));
+    EXPECT_EQ(Core::ERROR_GENERAL, handler.Invoke(connection, _T("ethmac"), _T(""), response));
+
+    RemoveDeviceDetailsScript();
+}
+
+TEST_F(DeviceInfoTest, EstbMac_Success)
+{
+    InstallDeviceDetailsScript("case \"$1 $2\" in \"read estb_mac\") echo \"11:22:33:44:55:66\" ;; *) exit 1 ;; esac\n");
 
     EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("estbmac"), _T(""), response));
     EXPECT_EQ(response, string("{\"estb_mac\":\"11:22:33:44:55:66\"}"));
+
+    RemoveDeviceDetailsScript();
 }
 
-TEST_F(DeviceInfoTest, EstbMac_Failure_PopenReturnsNull)
+TEST_F(DeviceInfoTest, EstbMac_Failure_ScriptMissing)
 {
-    EXPECT_CALL(*p_wrapsImplMock, v_secure_popen(::testing::_, ::testing::_, ::testing::_))
-        .Times(1)
-        .WillOnce(::testing::Return(nullptr));
+    RemoveDeviceDetailsScript();
 
     EXPECT_EQ(Core::ERROR_GENERAL, handler.Invoke(connection, _T("estbmac"), _T(""), response));
 }
 
 TEST_F(DeviceInfoTest, EstbMac_Success_NewlineStripped)
 {
-    EXPECT_CALL(*p_wrapsImplMock, v_secure_popen(::testing::_, ::testing::_, ::testing::_))
-        .Times(1)
-        .WillOnce(::testing::Invoke(
-            [&](const char* direction, const char* command, va_list args) {
-                const char mac[] = "AA:11:BB:22:CC:33\n";
-                char buffer[256];
-                strncpy(buffer, mac, sizeof(buffer) - 1);
-                return fmemopen(buffer, strlen(buffer), "r");
-            }));
-
-    EXPECT_CALL(*p_wrapsImplMock, v_secure_pclose(::testing::_))
-        .Times(1)
-        .WillOnce(::testing::Return(0));
+    InstallDeviceDetailsScript("printf 'AA:11:BB:22:CC:33\\n'\n");
 
     EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("estbmac"), _T(""), response));
+    // Verify newline is stripped - should not end with \n in JSON
     EXPECT_EQ(response, string("{\"estb_mac\":\"AA:11:BB:22:CC:33\"}"));
+
+    RemoveDeviceDetailsScript();
 }
 
 TEST_F(DeviceInfoTest, WifiMac_Success)
 {
-    EXPECT_CALL(*p_wrapsImplMock, v_secure_popen(::testing::_, ::testing::_, ::testing::_))
-        .Times(1)
-        .WillOnce(::testing::Invoke(
-            [&](const char* direction, const char* command, va_list args) {
-                va_list args2;
-                va_copy(args2, args);
-                char strFmt[256];
-                vsnprintf(strFmt, sizeof(strFmt), command, args2);
-                va_end(args2);
-                EXPECT_EQ(string(strFmt), string("/lib/rdk/getDeviceDetails.sh read wifi_mac"));
-
-                const char mac[] = "00:11:22:33:44:55\n";
-                char buffer[256];
-                memset(buffer, 0, sizeof(buffer));
-                strncpy(buffer, mac, sizeof(buffer) - 1);
-                FILE* pipe = fmemopen(buffer, strlen(buffer), "r");
-                return pipe;
-            }));
-
-    EXPECT_CALL(*p_wrapsImplMock, v_secure_pclose(::testing::_))
-        .Times(1)
-        .WillOnce(::testing::Return(0));
+    InstallDeviceDetailsScript("case \"$1 $2\" in \"read wifi_mac\") echo \"00:11:22:33:44:55\" ;; *) exit 1 ;; esac\n");
 
     EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("wifimac"), _T(""), response));
     EXPECT_EQ(response, string("{\"wifi_mac\":\"00:11:22:33:44:55\"}"));
+
+    RemoveDeviceDetailsScript();
 }
 
-TEST_F(DeviceInfoTest, WifiMac_Failure_PopenReturnsNull)
+TEST_F(DeviceInfoTest, WifiMac_Failure_ScriptMissing)
 {
-    EXPECT_CALL(*p_wrapsImplMock, v_secure_popen(::testing::_, ::testing::_, ::testing::_))
-        .Times(1)
-        .WillOnce(::testing::Return(nullptr));
+    RemoveDeviceDetailsScript();
 
     EXPECT_EQ(Core::ERROR_GENERAL, handler.Invoke(connection, _T("wifimac"), _T(""), response));
 }
 
 TEST_F(DeviceInfoTest, WifiMac_Success_NewlineStripped)
 {
-    EXPECT_CALL(*p_wrapsImplMock, v_secure_popen(::testing::_, ::testing::_, ::testing::_))
-        .Times(1)
-        .WillOnce(::testing::Invoke(
-            [&](const char* direction, const char* command, va_list args) {
-                const char mac[] = "FF:EE:DD:CC:BB:AA\n";
-                char buffer[256];
-                strncpy(buffer, mac, sizeof(buffer) - 1);
-                return fmemopen(buffer, strlen(buffer), "r");
-            }));
-
-    EXPECT_CALL(*p_wrapsImplMock, v_secure_pclose(::testing::_))
-        .Times(1)
-        .WillOnce(::testing::Return(0));
+    InstallDeviceDetailsScript("printf 'FF:EE:DD:CC:BB:AA\\n'\n");
 
     EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("wifimac"), _T(""), response));
+    // Verify newline is stripped - should not end with \n in JSON
     EXPECT_EQ(response, string("{\"wifi_mac\":\"FF:EE:DD:CC:BB:AA\"}"));
+
+    RemoveDeviceDetailsScript();
 }
 
 TEST_F(DeviceInfoTest, EstbIp_Success)
 {
-    EXPECT_CALL(*p_wrapsImplMock, v_secure_popen(::testing::_, ::testing::_, ::testing::_))
-        .Times(1)
-        .WillOnce(::testing::Invoke(
-            [&](const char* direction, const char* command, va_list args) {
-                va_list args2;
-                va_copy(args2, args);
-                char strFmt[256];
-                vsnprintf(strFmt, sizeof(strFmt), command, args2);
-                va_end(args2);
-                EXPECT_EQ(string(strFmt), string("/lib/rdk/getDeviceDetails.sh read estb_ip"));
-
-                const char ip[] = "192.168.1.100\n";
-                char buffer[256];
-                memset(buffer, 0, sizeof(buffer));
-                strncpy(buffer, ip, sizeof(buffer) - 1);
-                FILE* pipe = fmemopen(buffer, strlen(buffer), "r");
-                return pipe;
-            }));
-
-    EXPECT_CALL(*p_wrapsImplMock, v_secure_pclose(::testing::_))
-        .Times(1)
-        .WillOnce(::testing::Return(0));
+    InstallDeviceDetailsScript("case \"$1 $2\" in \"read estb_ip\") echo \"192.168.1.100\" ;; *) exit 1 ;; esac\n");
 
     EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("estbip"), _T(""), response));
     EXPECT_EQ(response, string("{\"estb_ip\":\"192.168.1.100\"}"));
+
+    RemoveDeviceDetailsScript();
 }
 
-TEST_F(DeviceInfoTest, EstbIp_Failure_PopenReturnsNull)
+TEST_F(DeviceInfoTest, EstbIp_Failure_ScriptMissing)
 {
-    EXPECT_CALL(*p_wrapsImplMock, v_secure_popen(::testing::_, ::testing::_, ::testing::_))
-        .Times(1)
-        .WillOnce(::testing::Return(nullptr));
+    RemoveDeviceDetailsScript();
 
     EXPECT_EQ(Core::ERROR_GENERAL, handler.Invoke(connection, _T("estbip"), _T(""), response));
 }
 
 TEST_F(DeviceInfoTest, EstbIp_Success_NewlineStripped)
 {
-    EXPECT_CALL(*p_wrapsImplMock, v_secure_popen(::testing::_, ::testing::_, ::testing::_))
-        .Times(1)
-        .WillOnce(::testing::Invoke(
-            [&](const char* direction, const char* command, va_list args) {
-                const char ip[] = "10.0.0.1\n";
-                char buffer[256];
-                strncpy(buffer, ip, sizeof(buffer) - 1);
-                return fmemopen(buffer, strlen(buffer), "r");
-            }));
-
-    EXPECT_CALL(*p_wrapsImplMock, v_secure_pclose(::testing::_))
-        .Times(1)
-        .WillOnce(::testing::Return(0));
+    InstallDeviceDetailsScript("printf '10.0.0.1\\n'\n");
 
     EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("estbip"), _T(""), response));
+    // Verify newline is stripped - should not end with \n in JSON
     EXPECT_EQ(response, string("{\"estb_ip\":\"10.0.0.1\"}"));
+
+    RemoveDeviceDetailsScript();
+}
+
+TEST_F(DeviceInfoTest, EstbIp_Failure_ScriptTimesOut)
+{
+    InstallDeviceDetailsScript("sleep 5\necho \"10.0.0.1\"\n");
+
+    ON_CALL(service, ConfigLine())
+        .WillByDefault(Return(DeviceDetailsConfig(_T("\"timeout\":200"))));
+    EXPECT_EQ(Core::ERROR_NONE, deviceInfoImplementation->Configure(&service));
+
+    EXPECT_EQ(Core::ERROR_TIMEDOUT, handler.Invoke(connection, _T("estbip"), _T(""), response));
+
+    RemoveDeviceDetailsScript();
+}
+
+TEST_F(DeviceInfoTest, NetworkIdentity_Success_OneScriptRun)
+{
+    const string runsPath = scriptDirectory + _T("/runs");
+    InstallDeviceDetailsScript("echo run >> " + runsPath + "\n"
+        "[ -n \"$2\" ] && exit 1\n"
+        "printf 'bluetooth_mac=01:02:03:04:05:06\\neth_mac=AA:BB:CC:DD:EE:FF\\nestb_mac=11:22:33:44:55:66\\n'\n"
+        "printf 'wifi_mac=00:11:22:33:44:55\\nestb_ip=192.168.1.100\\n'\n");
+
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("networkidentity"), _T(""), response));
+    EXPECT_EQ(response, string("{\"eth_mac\":\"AA:BB:CC:DD:EE:FF\",\"estb_mac\":\"11:22:33:44:55:66\",\"wifi_mac\":\"00:11:22:33:44:55\",\"estb_ip\":\"192.168.1.100\"}"));
+
+    std::ifstream runs(runsPath);
+    string line;
+    int count = 0;
+    while (std::getline(runs, line)) {
+        count++;
+    }
+    EXPECT_EQ(1, count);
+
+    remove(runsPath.c_str());
+    RemoveDeviceDetailsScript();
+}
+
+TEST_F(DeviceInfoTest, NetworkIdentity_Success_ScriptNeedsField)
+{
+    const string runsPath = scriptDirectory + _T("/runs");
+    InstallDeviceDetailsScript("echo run >> " + runsPath + "\n"
+        "case \"$2\" in\n"
+        "eth_mac) echo \"AA:BB:CC:DD:EE:FF\" ;;\n"
+        "estb_mac) echo \"11:22:33:44:55:66\" ;;\n"
+        "estb_ip) echo \"192.168.1.100\" ;;\n"
+        "*) exit 1 ;;\n"
+        "esac\n");
+
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("networkidentity"), _T(""), response));
+    EXPECT_EQ(response, string("{\"eth_mac\":\"AA:BB:CC:DD:EE:FF\",\"estb_mac\":\"11:22:33:44:55:66\",\"estb_ip\":\"192.168.1.100\"}"));
+
+    // One for the read without a field, then one per field.
+    std::ifstream runs(runsPath);
+    string line;
+    int count = 0;
+    while (std::getline(runs, line)) {
+        count++;
+    }
+    EXPECT_EQ(5, count);
+
+    remove(runsPath.c_str());
+    RemoveDeviceDetailsScript();
+}
+
+TEST_F(DeviceInfoTest, EthMac_Success_OneRunForTheField)
+{
+    const string runsPath = scriptDirectory + _T("/runs");
+    InstallDeviceDetailsScript("echo \"$2\" >> " + runsPath + "\n"
+        "echo \"AA:BB:CC:DD:EE:FF\"\n");
+
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("ethmac"), _T(""), response));
+
+    // A standalone getter never pays for the read of all four fields.
+    std::ifstream runs(runsPath);
+    string line;
+    std::vector<string> fields;
+    while (std::getline(runs, line)) {
+        fields.push_back(line);
+    }
+    ASSERT_EQ(fields.size(), 1u);
+    EXPECT_EQ(fields.front(), _T("eth_mac"));
+
+    remove(runsPath.c_str());
+    RemoveDeviceDetailsScript();
+}
+
+TEST_F(DeviceInfoTest, NetworkIdentity_Failure_ScriptMissing)
+{
+    RemoveDeviceDetailsScript();
+
+    EXPECT_EQ(Core::ERROR_GENERAL, handler.Invoke(connection, _T("networkidentity"), _T(""), response));
+}
+
+TEST_F(DeviceInfoTest, EstbIp_Success_NativeModeReadsInterface)
+{
+    ON_CALL(service, ConfigLine())
+        .WillByDefault(Return("{\"systeminfo\":{\"interval\":0},\"devicedetails\":{\"mode\":\"native\",\"ethernet\":\"lo\",\"estb\":\"lo\"}}"));
+    EXPECT_EQ(Core::ERROR_NONE, deviceInfoImplementation->Configure(&service));
+
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("ethmac"), _T(""), response));
+    EXPECT_EQ(response, string("{\"eth_mac\":\"00:00:00:00:00:00\"}"));
+    EXPECT_EQ(Core::ERROR_NONE, handler.Invoke(connection, _T("estbip"), _T(""), response));
+    EXPECT_EQ(response, string("{\"estb_ip\":\"127.0.0.1\"}"));
+}
+
+TEST_F(DeviceInfoTest, WifiMac_Failure_NativeModeUnknownInterface)
+{
+    ON_CALL(service, ConfigLine())
+        .WillByDefault(Return("{\"systeminfo\":{\"interval\":0},\"devicedetails\":{\"mode\":\"native\",\"wifi\":\"nosuchif0\"}}"));
+    EXPECT_EQ(Core::ERROR_NONE, deviceInfoImplementation->Configure(&service));
+
+    EXPECT_EQ(Core::ERROR_GENERAL, handler.Invoke(connection, _T("wifimac"), _T(""), response));
 }
 
 TEST_F(DeviceInfoTest, Information_Success)
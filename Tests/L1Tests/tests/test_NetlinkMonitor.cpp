@@ -0,0 +1,116 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2024 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+
+#include <gtest/gtest.h>
+
+#include "NetlinkMonitor.h"
+#include "FakeRtnetlink.h"
+#include <condition_variable>
+#include <list>
+#include <mutex>
+#include <net/if.h>
+
+using namespace WPEFramework;
+
+namespace {
+
+    // Collects the interface names the monitor reports.
+    class AddressChanges : public Plugin::NetlinkMonitor::ICallback {
+    public:
+        AddressChanges(const AddressChanges&) = delete;
+        AddressChanges& operator=(const AddressChanges&) = delete;
+
+        AddressChanges() = default;
+        ~AddressChanges() override = default;
+
+        void AddressChanged(const string& interfaceName) override
+        {
+            std::lock_guard<std::mutex> guard(_lock);
+            _names.push_back(interfaceName);
+            _reported.notify_all();
+        }
+
+        // The next reported name, or "none" when nothing is reported within a few seconds.
+        string Next()
+        {
+            std::unique_lock<std::mutex> guard(_lock);
+            if (_reported.wait_for(guard, std::chrono::seconds(5), [this]() { return (_names.empty() == false); }) == false) {
+                return (_T("none"));
+            }
+            const string name = _names.front();
+            _names.pop_front();
+            return (name);
+        }
+
+    private:
+        std::mutex _lock;
+        std::condition_variable _reported;
+        std::list<string> _names;
+    };
+
+}
+
+TEST(NetlinkMonitorTest, ModelFollowsDumpAndEvents)
+{
+    FakeRtnetlink kernel;
+    kernel.Link(2, _T("eth0"), { 0x00, 0x11, 0x22, 0xaa, 0xbb, 0xcc }, IFF_UP | IFF_RUNNING);
+    kernel.Address(2, AF_INET6, _T("fe80::211:22ff:feaa:bbcc"), 64, RT_SCOPE_LINK);
+    kernel.Address(2, AF_INET6, _T("2001:db8::20"), 64, RT_SCOPE_UNIVERSE);
+    kernel.Link(3, _T("wlan0"), { 0x00, 0x11, 0x22, 0xaa, 0xbb, 0xcd }, 0);
+
+    AddressChanges changes;
+    Plugin::NetlinkMonitor monitor;
+    ASSERT_EQ(Core::ERROR_NONE, monitor.Start(&changes, kernel.Socket()));
+    EXPECT_TRUE(monitor.Running());
+
+    std::list<Plugin::NetlinkMonitor::Link> links;
+    monitor.Links(links);
+    ASSERT_EQ(links.size(), 2u);
+    EXPECT_EQ(links.front().name, _T("eth0"));
+    EXPECT_EQ(links.front().mac, _T("00:11:22:aa:bb:cc"));
+    EXPECT_EQ(links.front().addresses.size(), 2u);
+    EXPECT_EQ(links.back().name, _T("wlan0"));
+    EXPECT_EQ(links.back().flags & IFF_UP, 0u);
+
+    string mac;
+    string ip;
+    EXPECT_EQ(Core::ERROR_NONE, monitor.MACAddress(_T("eth0"), mac));
+    EXPECT_EQ(mac, _T("00:11:22:AA:BB:CC"));
+    // Without IPv4, the first global IPv6 address.
+    EXPECT_EQ(Core::ERROR_NONE, monitor.IPAddress(_T("eth0"), ip));
+    EXPECT_EQ(ip, _T("2001:db8::20"));
+    EXPECT_NE(Core::ERROR_NONE, monitor.IPAddress(_T("wlan0"), ip));
+    EXPECT_NE(Core::ERROR_NONE, monitor.MACAddress(_T("eth1"), mac));
+
+    const uint32_t generation = monitor.Generation();
+    kernel.AddressEvent(RTM_NEWADDR, 2, AF_INET, _T("192.168.1.20"), 24, RT_SCOPE_UNIVERSE);
+    EXPECT_EQ(changes.Next(), _T("eth0"));
+    EXPECT_NE(monitor.Generation(), generation);
+    EXPECT_EQ(Core::ERROR_NONE, monitor.IPAddress(_T("eth0"), ip));
+    EXPECT_EQ(ip, _T("192.168.1.20"));
+
+    kernel.AddressEvent(RTM_DELADDR, 2, AF_INET, _T("192.168.1.20"), 24, RT_SCOPE_UNIVERSE);
+    EXPECT_EQ(changes.Next(), _T("eth0"));
+    EXPECT_EQ(Core::ERROR_NONE, monitor.IPAddress(_T("eth0"), ip));
+    EXPECT_EQ(ip, _T("2001:db8::20"));
+
+    monitor.Stop();
+    EXPECT_FALSE(monitor.Running());
+}
@@ -0,0 +1,50 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2024 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+
+#include <gtest/gtest.h>
+
+#include "PressureMonitor.h"
+
+using namespace WPEFramework;
+
+TEST(PressureMonitorTest, ReadsAveragesAndIgnoresUnsetTriggers)
+{
+    Plugin::PressureMonitor::Pressure pressure{};
+
+    if (Plugin::PressureMonitor::Read(Plugin::PressureMonitor::MEMORY, pressure) == Core::ERROR_NONE) {
+        EXPECT_GE(pressure.some.avg10, 0.0);
+        EXPECT_LE(pressure.some.avg10, 100.0);
+        EXPECT_LE(pressure.full.total, pressure.some.total);
+    }
+
+    class Callback : public Plugin::PressureMonitor::ICallback {
+    public:
+        void PressureStall(const Plugin::PressureMonitor::resource) override
+        {
+        }
+    } callback;
+
+    Plugin::PressureMonitor monitor;
+    const string triggers[Plugin::PressureMonitor::RESOURCES];
+
+    EXPECT_EQ(Core::ERROR_NONE, monitor.Start(triggers, &callback));
+    EXPECT_FALSE(monitor.Running());
+    monitor.Stop();
+}
@@ -0,0 +1,66 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2024 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+
+#include <gtest/gtest.h>
+
+#include "ProcfsReader.h"
+
+using namespace WPEFramework;
+
+TEST(ProcfsReaderTest, ReadsMeminfoStatAndLoadavg)
+{
+    Plugin::ProcfsReader reader;
+    Plugin::ProcfsReader::Memory memory{};
+    uint32_t load = 0;
+    uint64_t averages[3] = {};
+
+    ASSERT_EQ(Core::ERROR_NONE, reader.Meminfo(memory));
+    EXPECT_GT(memory.total, 0u);
+    EXPECT_LE(memory.free, memory.total);
+    EXPECT_LE(memory.available, memory.total);
+    EXPECT_EQ(memory.total % 1024, 0u);
+
+    Plugin::ProcfsReader::CpuBaseline baseline;
+    EXPECT_EQ(Core::ERROR_NONE, reader.CpuLoad(baseline, load));
+    EXPECT_EQ(Core::ERROR_NONE, reader.CpuLoad(baseline, load));
+    EXPECT_LE(load, 100u);
+
+    EXPECT_EQ(Core::ERROR_NONE, reader.LoadAverage(averages));
+}
+
+TEST(ProcfsReaderTest, SampleKeepsCpuBaselinesApart)
+{
+    Plugin::ProcfsReader reader;
+    Plugin::ProcfsReader::CpuBaseline busy;
+    Plugin::ProcfsReader::CpuBaseline idle;
+    Plugin::ProcfsReader::Figures figures{};
+
+    reader.Sample(busy, figures);
+    EXPECT_GT(figures.memory.total, 0u);
+    EXPECT_LE(figures.cpuLoad, 100u);
+
+    // A fresh baseline measures since boot, whatever the other one saw last.
+    uint32_t sinceBoot = 0;
+    uint32_t again = 0;
+    EXPECT_EQ(Core::ERROR_NONE, reader.CpuLoad(idle, sinceBoot));
+    Plugin::ProcfsReader::CpuBaseline fresh;
+    EXPECT_EQ(Core::ERROR_NONE, reader.CpuLoad(fresh, again));
+    EXPECT_NEAR(sinceBoot, again, 1);
+}
@@ -0,0 +1,115 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2024 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+
+#include <gtest/gtest.h>
+
+#include "SingleFlight.h"
+#include <atomic>
+#include <future>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace WPEFramework;
+
+TEST(SingleFlightTest, ConcurrentCallersShareOneFetch)
+{
+    Plugin::SingleFlight flight;
+    std::promise<void> release;
+    std::shared_future<void> released(release.get_future());
+    std::promise<void> entered;
+    std::atomic<uint32_t> fetches(0);
+
+    auto fetch = [&](string& value) -> uint32_t {
+        if (fetches++ == 0) {
+            entered.set_value();
+        }
+        // Hold the backend call until every caller is queued behind it.
+        released.wait();
+        value = _T("SHARED0001");
+        return (Core::ERROR_NONE);
+    };
+
+    string values[4];
+    uint32_t results[4];
+    std::vector<std::thread> callers;
+
+    callers.emplace_back([&]() { results[0] = flight.Do(_T("serialnumber"), values[0], fetch); });
+    ASSERT_EQ(std::future_status::ready, entered.get_future().wait_for(std::chrono::seconds(5)));
+
+    for (int index = 1; index < 4; index++) {
+        callers.emplace_back([&, index]() { results[index] = flight.Do(_T("serialnumber"), values[index], fetch); });
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while ((flight.Waiting(_T("serialnumber")) < 3) && (std::chrono::steady_clock::now() < deadline)) {
+        std::this_thread::yield();
+    }
+    EXPECT_EQ(3u, flight.Waiting(_T("serialnumber")));
+    release.set_value();
+
+    for (std::thread& caller : callers) {
+        caller.join();
+    }
+
+    EXPECT_EQ(1u, fetches.load());
+    for (int index = 0; index < 4; index++) {
+        EXPECT_EQ(Core::ERROR_NONE, results[index]);
+        EXPECT_EQ(_T("SHARED0001"), values[index]);
+    }
+}
+
+TEST(SingleFlightTest, WaitersFailWhenTheFetchThrows)
+{
+    Plugin::SingleFlight flight;
+    std::promise<void> release;
+    std::shared_future<void> released(release.get_future());
+    std::promise<void> entered;
+
+    std::thread owner([&]() {
+        string value;
+        EXPECT_THROW(flight.Do(_T("serialnumber"), value, [&](string&) -> uint32_t {
+            entered.set_value();
+            released.wait();
+            throw std::runtime_error("backend failure");
+        }),
+            std::runtime_error);
+    });
+    ASSERT_EQ(std::future_status::ready, entered.get_future().wait_for(std::chrono::seconds(5)));
+
+    string value = _T("untouched");
+    uint32_t result = Core::ERROR_NONE;
+    std::thread waiter([&]() {
+        result = flight.Do(_T("serialnumber"), value, [](string&) -> uint32_t { return (Core::ERROR_NONE); });
+    });
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while ((flight.Waiting(_T("serialnumber")) < 1) && (std::chrono::steady_clock::now() < deadline)) {
+        std::this_thread::yield();
+    }
+    EXPECT_EQ(1u, flight.Waiting(_T("serialnumber")));
+    release.set_value();
+
+    owner.join();
+    waiter.join();
+
+    EXPECT_EQ(Core::ERROR_GENERAL, result);
+    EXPECT_EQ(_T("untouched"), value);
+}
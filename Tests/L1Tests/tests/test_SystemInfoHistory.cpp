@@ -0,0 +1,56 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2024 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+
+#include <gtest/gtest.h>
+
+#include "SystemInfoHistory.h"
+#include <list>
+
+using namespace WPEFramework;
+
+TEST(SystemInfoHistoryTest, KeepsNewestSamplesWithinWindow)
+{
+    Plugin::SystemInfoHistory history;
+    std::list<Plugin::SystemInfoHistory::Entry> entries;
+
+    history.Add({ Core::Time::Now().Ticks(), 1, 0, 0, 0, 0, 0 });
+    history.Entries(60, entries);
+    EXPECT_TRUE(entries.empty());
+
+    history.Capacity(3);
+    EXPECT_EQ(history.Capacity(), 3u);
+
+    const uint64_t now = Core::Time::Now().Ticks();
+    const uint64_t second = 1000 * Core::Time::TicksPerMillisecond;
+    for (uint32_t load = 1; load <= 4; load++) {
+        history.Add({ now - ((4 - load) * 10 * second), load, load * 100, 0, 0, 0, 0 });
+    }
+
+    history.Entries(60, entries);
+    ASSERT_EQ(entries.size(), 3u);
+    EXPECT_EQ(entries.front().cpuload, 2u);
+    EXPECT_EQ(entries.back().cpuload, 4u);
+    EXPECT_EQ(entries.back().freeram, 400u);
+
+    entries.clear();
+    history.Entries(15, entries);
+    ASSERT_EQ(entries.size(), 2u);
+    EXPECT_EQ(entries.front().cpuload, 3u);
+}
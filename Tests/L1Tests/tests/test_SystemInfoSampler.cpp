@@ -0,0 +1,73 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2024 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+
+#include <gtest/gtest.h>
+
+#include "SystemInfoSampler.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace WPEFramework;
+
+TEST(SystemInfoSamplerTest, PublishesFirstSampleAtOnceAndKeepsRefreshing)
+{
+    class Source : public Plugin::SystemInfoSampler::ICallback {
+    public:
+        Source()
+            : samples(0)
+        {
+        }
+
+        void Sample(Exchange::IDeviceInfo::SystemInfos& info) const override
+        {
+            samples++;
+            info.uptime = samples;
+            if (info.serialnumber.empty() == true) {
+                info.serialnumber = _T("SERIAL") + std::to_string(samples.load());
+            }
+        }
+
+        mutable std::atomic<uint32_t> samples;
+    } source;
+
+    Plugin::SystemInfoSampler sampler;
+    Exchange::IDeviceInfo::SystemInfos info{};
+    uint64_t sampled = 0;
+
+    EXPECT_FALSE(sampler.Latest(info, sampled));
+
+    sampler.Start(&source, 20);
+    EXPECT_TRUE(sampler.Latest(info, sampled));
+    EXPECT_EQ(info.serialnumber, _T("SERIAL1"));
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while ((source.samples < 3) && (std::chrono::steady_clock::now() < deadline)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    ASSERT_GE(source.samples.load(), 3u);
+    EXPECT_TRUE(sampler.Latest(info, sampled));
+    EXPECT_GE(info.uptime, 2u);
+    EXPECT_EQ(info.serialnumber, _T("SERIAL1"));
+
+    sampler.Stop();
+    EXPECT_FALSE(sampler.Running());
+    EXPECT_FALSE(sampler.Latest(info, sampled));
+}
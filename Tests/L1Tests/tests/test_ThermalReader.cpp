@@ -0,0 +1,85 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2024 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+
+#include <gtest/gtest.h>
+
+#include "ThermalReader.h"
+#include "FakeSysfs.h"
+
+using namespace WPEFramework;
+
+TEST(ThermalReaderTest, ReadsZonesCoolingDevicesAndCpufreq)
+{
+    FakeSysfs sysfs;
+    sysfs.Write(_T("thermal/thermal_zone1/type"), _T("gpu-thermal"));
+    sysfs.Write(_T("thermal/thermal_zone1/temp"), _T("48000"));
+    sysfs.Write(_T("thermal/thermal_zone0/type"), _T("cpu-thermal"));
+    sysfs.Write(_T("thermal/thermal_zone0/temp"), _T("-5000"));
+    sysfs.Write(_T("thermal/cooling_device0/type"), _T("cpufreq-cpu0"));
+    sysfs.Write(_T("thermal/cooling_device0/cur_state"), _T("2"));
+    sysfs.Write(_T("thermal/cooling_device0/max_state"), _T("4"));
+    sysfs.Write(_T("thermal/cooling_device0/stats/total_trans"), _T("17"));
+    // Without statistics, as on kernels built without CONFIG_THERMAL_STATISTICS.
+    sysfs.Write(_T("thermal/cooling_device1/type"), _T("fan"));
+    sysfs.Write(_T("thermal/cooling_device1/cur_state"), _T("0"));
+    sysfs.Write(_T("cpu/cpu0/cpufreq/scaling_cur_freq"), _T("1200000"));
+    sysfs.Write(_T("cpu/cpu0/cpufreq/cpuinfo_max_freq"), _T("1800000"));
+    sysfs.Write(_T("cpu/cpufreq/boost"), _T("0"));
+
+    Plugin::ThermalReader reader(sysfs.Thermal(), sysfs.Cpus());
+    Plugin::ThermalReader::Sample sample;
+    ASSERT_EQ(Core::ERROR_NONE, reader.Read(sample));
+
+    ASSERT_EQ(sample.zones.size(), 2u);
+    EXPECT_EQ(sample.zones[0].name, _T("cpu-thermal"));
+    EXPECT_EQ(sample.zones[0].temperature, -5000);
+    EXPECT_EQ(sample.zones[1].name, _T("gpu-thermal"));
+    EXPECT_EQ(sample.zones[1].temperature, 48000);
+
+    ASSERT_EQ(sample.coolings.size(), 2u);
+    EXPECT_EQ(sample.coolings[0].name, _T("cpufreq-cpu0"));
+    EXPECT_EQ(sample.coolings[0].state, 2u);
+    EXPECT_EQ(sample.coolings[0].maxState, 4u);
+    EXPECT_EQ(sample.coolings[0].transitions, 17u);
+    EXPECT_EQ(sample.coolings[1].name, _T("fan"));
+    EXPECT_EQ(sample.coolings[1].transitions, 0u);
+
+    ASSERT_EQ(sample.cpus.size(), 1u);
+    EXPECT_EQ(sample.cpus[0].id, 0u);
+    EXPECT_EQ(sample.cpus[0].frequency, 1200000u);
+    EXPECT_EQ(sample.cpus[0].maxFrequency, 1800000u);
+
+    // The attributes stay open, so a new value shows up in the next sample.
+    sysfs.Write(_T("thermal/thermal_zone1/temp"), _T("71500"));
+    sysfs.Write(_T("thermal/cooling_device0/stats/total_trans"), _T("18"));
+    ASSERT_EQ(Core::ERROR_NONE, reader.Read(sample));
+    EXPECT_EQ(sample.zones[1].temperature, 71500);
+    EXPECT_EQ(sample.coolings[0].transitions, 18u);
+}
+
+TEST(ThermalReaderTest, UnavailableWithoutAnyAttribute)
+{
+    FakeSysfs sysfs;
+    sysfs.Write(_T("thermal/thermal_zone0/type"), _T("no-temp"));
+
+    Plugin::ThermalReader reader(sysfs.Thermal(), sysfs.Cpus());
+    Plugin::ThermalReader::Sample sample;
+    EXPECT_EQ(Core::ERROR_UNAVAILABLE, reader.Read(sample));
+}
@@ -0,0 +1,89 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2024 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+
+#include <gtest/gtest.h>
+
+#include "ThermalReader.h"
+#include "FakeSysfs.h"
+#include <list>
+
+using namespace WPEFramework;
+
+TEST(ThermalThresholdTest, ReportsCrossingsWithHysteresis)
+{
+    FakeSysfs sysfs;
+    sysfs.Write(_T("thermal/thermal_zone0/type"), _T("cpu-thermal"));
+    sysfs.Write(_T("thermal/thermal_zone0/temp"), _T("50000"));
+    sysfs.Write(_T("thermal/thermal_zone1/type"), _T("gpu-thermal"));
+    sysfs.Write(_T("thermal/thermal_zone1/temp"), _T("40000"));
+
+    Plugin::ThermalReader reader(sysfs.Thermal(), sysfs.Cpus());
+    Plugin::ThermalReader::Sample sample;
+    Plugin::ThermalThreshold threshold;
+    std::list<Plugin::ThermalThreshold::Crossing> crossings;
+
+    auto update = [&](const TCHAR cpu[], const TCHAR gpu[]) {
+        sysfs.Write(_T("thermal/thermal_zone0/temp"), cpu);
+        sysfs.Write(_T("thermal/thermal_zone1/temp"), gpu);
+        crossings.clear();
+        ASSERT_EQ(Core::ERROR_NONE, reader.Read(sample));
+        threshold.Update(sample.zones, crossings);
+    };
+
+    // Disabled until configured.
+    update(_T("90000"), _T("90000"));
+    EXPECT_TRUE(crossings.empty());
+
+    threshold.Configure(60000, 2000);
+    update(_T("59999"), _T("40000"));
+    EXPECT_TRUE(crossings.empty());
+
+    update(_T("60000"), _T("40000"));
+    ASSERT_EQ(crossings.size(), 1u);
+    EXPECT_EQ(crossings.front().zone, _T("cpu-thermal"));
+    EXPECT_EQ(crossings.front().temperature, 60000);
+    EXPECT_TRUE(crossings.front().above);
+
+    // Within the hysteresis the zone stays above.
+    update(_T("58000"), _T("40000"));
+    EXPECT_TRUE(crossings.empty());
+
+    update(_T("57999"), _T("61000"));
+    ASSERT_EQ(crossings.size(), 2u);
+    EXPECT_EQ(crossings.front().zone, _T("cpu-thermal"));
+    EXPECT_FALSE(crossings.front().above);
+    EXPECT_EQ(crossings.back().zone, _T("gpu-thermal"));
+    EXPECT_TRUE(crossings.back().above);
+
+    // Back below, it takes the full threshold to count as above again.
+    update(_T("59000"), _T("61000"));
+    EXPECT_TRUE(crossings.empty());
+
+    // Reconfiguring starts every zone below; a hysteresis above the threshold is clamped to it.
+    threshold.Configure(1000, 5000);
+    update(_T("1000"), _T("0"));
+    ASSERT_EQ(crossings.size(), 1u);
+    EXPECT_TRUE(crossings.front().above);
+    update(_T("0"), _T("0"));
+    EXPECT_TRUE(crossings.empty());
+    update(_T("-1"), _T("0"));
+    ASSERT_EQ(crossings.size(), 1u);
+    EXPECT_FALSE(crossings.front().above);
+}
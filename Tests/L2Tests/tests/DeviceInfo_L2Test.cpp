@@ -22,6 +22,7 @@
 #include "L2Tests.h"
 #include "L2TestsMock.h"
 #include <fstream>
+#include <sys/stat.h>
 #include "MfrMock.h"
 #include "IarmBusMock.h"
 #include "SystemInfo.h"
@@ -39,6 +40,31 @@ using ::testing::NiceMock;
 using namespace WPEFramework;
 using testing::StrictMock;
 
+// The plugin is configured with this script by the build (devicedetails.script).
+#ifndef DEVICEDETAILS_SCRIPT
+#define DEVICEDETAILS_SCRIPT "/lib/rdk/getDeviceDetails.sh"
+#endif
+
+namespace {
+    const char DeviceDetailsScriptPath[] = DEVICEDETAILS_SCRIPT;
+
+    // Stands in for the vendor getDeviceDetails.sh, which DeviceInfo runs as "<script> read <field>".
+    void InstallDeviceDetailsScript(const string& body)
+    {
+        const string path(DeviceDetailsScriptPath);
+        mkdir(path.substr(0, path.rfind('/')).c_str(), 0755);
+        std::ofstream script(DeviceDetailsScriptPath);
+        script << "#!/bin/sh\n" << body;
+        script.close();
+        chmod(DeviceDetailsScriptPath, 0755);
+    }
+
+    void RemoveDeviceDetailsScript()
+    {
+        remove(DeviceDetailsScriptPath);
+    }
+}
+
 class DeviceInfo_L2test : public L2TestMocks {
 protected:
     Core::JSONRPC::Message message;
@@ -49,6 +75,7 @@ protected:
 public:
     DeviceInfo_L2test();
     uint32_t CreateDeviceInfoInterfaceObject();
+    void RefreshIdentitySnapshot();
     void SetUp() override;
     void TearDown() override;
 
@@ -176,6 +203,18 @@ uint32_t DeviceInfo_L2test::CreateDeviceInfoInterfaceObject()
     return return_value;
 }
 
+/**
+* @brief Re-activates DeviceInfo so its identity snapshot is taken from the
+* mocks and files the test has installed since the fixture activated it
+*/
+void DeviceInfo_L2test::RefreshIdentitySnapshot()
+{
+    TearDown();
+    EXPECT_EQ(Core::ERROR_NONE, DeactivateService("DeviceInfo"));
+    EXPECT_EQ(Core::ERROR_NONE, ActivateService("DeviceInfo"));
+    SetUp();
+}
+
 void DeviceInfo_L2test::SetUp()
 {
     if ((m_deviceinfoplugin == nullptr) || (m_controller_deviceinfo == nullptr)) {
@@ -441,6 +480,8 @@ TEST_F(DeviceInfo_L2test, DeviceInfo_L2_PropertyTest)
                     param->type =  mfrSERIALIZED_TYPE_SERIALNUMBER;
                     return IARM_RESULT_SUCCESS;
                 });
+        RefreshIdentitySnapshot();
+
         JsonObject getResults;
         uint32_t getResult = InvokeServiceMethod(DEVICEINFO_CALLSIGN, "systeminfo@0", getResults);
         EXPECT_EQ(Core::ERROR_NONE, getResult);
@@ -557,6 +598,8 @@ TEST_F(DeviceInfo_L2test, DeviceInfo_L2_PropertyTest)
                     return IARM_RESULT_SUCCESS;
                 });
         
+        RefreshIdentitySnapshot();
+
         JsonObject getResults;
         uint32_t getResult = InvokeServiceMethod(DEVICEINFO_CALLSIGN, "make@0", getResults);
         EXPECT_EQ(Core::ERROR_NONE, getResult);
@@ -577,6 +620,8 @@ TEST_F(DeviceInfo_L2test, DeviceInfo_L2_PropertyTest)
         file << "FRIENDLY_ID=\"CUSTOM4 CUSTOM9\"";
         file.close();
 
+        RefreshIdentitySnapshot();
+
         JsonObject getResults;
         uint32_t getResult = InvokeServiceMethod(DEVICEINFO_CALLSIGN, "modelname@0", getResults);
         EXPECT_EQ(Core::ERROR_NONE, getResult);
@@ -632,6 +677,8 @@ TEST_F(DeviceInfo_L2test, DeviceInfo_L2_PropertyTest)
         file << "SOC=NVIDIA\n";
         file.close();
 
+        RefreshIdentitySnapshot();
+
         JsonObject getResults;
         uint32_t getResult = InvokeServiceMethod(DEVICEINFO_CALLSIGN, "socname@0", getResults);
         EXPECT_EQ(Core::ERROR_NONE, getResult);
@@ -682,6 +729,8 @@ TEST_F(DeviceInfo_L2test, DeviceInfo_L2_PropertyTest)
         file << "CHIPSET_NAME=TestChipset\n";
         file.close();
 
+        RefreshIdentitySnapshot();
+
         JsonObject getResults;
         uint32_t getResult = InvokeServiceMethod(DEVICEINFO_CALLSIGN, "chipset@0", getResults);
         EXPECT_EQ(Core::ERROR_NONE, getResult);
@@ -1141,6 +1190,8 @@ TEST_F(DeviceInfo_L2test, DeviceInfo_L2_PropertyEdgeCaseTest)
                     return IARM_RESULT_INVALID_PARAM;
                 });
 
+        RefreshIdentitySnapshot();
+
         JsonObject getResults;
         uint32_t getResult = InvokeServiceMethod(DEVICEINFO_CALLSIGN, "serialnumber@0", getResults);
         EXPECT_EQ(Core::ERROR_NONE, getResult);
@@ -1162,6 +1213,8 @@ TEST_F(DeviceInfo_L2test, DeviceInfo_L2_PropertyEdgeCaseTest)
         file << "MFG_NAME=EdgeCaseManufacturer\n";
         file.close();
 
+        RefreshIdentitySnapshot();
+
         JsonObject getResults;
         uint32_t getResult = InvokeServiceMethod(DEVICEINFO_CALLSIGN, "make@0", getResults);
         EXPECT_EQ(Core::ERROR_NONE, getResult);
@@ -1182,6 +1235,8 @@ TEST_F(DeviceInfo_L2test, DeviceInfo_L2_PropertyEdgeCaseTest)
         file << "FRIENDLY_ID=\"Quoted Model Name\"\n";
         file.close();
 
+        RefreshIdentitySnapshot();
+
         JsonObject getResults;
         uint32_t getResult = InvokeServiceMethod(DEVICEINFO_CALLSIGN, "modelname@0", getResults);
         EXPECT_EQ(Core::ERROR_NONE, getResult);
@@ -1509,33 +1564,13 @@ TEST_F(DeviceInfo_L2test, DeviceInfo_JsonRpc_MacAddressesAndIp)
 
     TEST_LOG("Starting DeviceInfo L2 JsonRpc MAC Addresses and IP Tests\n");
 
-    ON_CALL(*p_wrapsImplMock, v_secure_popen(::testing::_, ::testing::_, ::testing::_))
-        .WillByDefault(::testing::Invoke(
-            [](const char* type, const char* command, va_list args) -> FILE* {
-                va_list args2;
-                va_copy(args2, args);
-                char strFmt[256];
-                vsnprintf(strFmt, sizeof(strFmt), command, args2);
-                va_end(args2);
-                
-                const char* valueToReturn = nullptr;
-                
-                if (strcmp(strFmt, "/lib/rdk/getDeviceDetails.sh read eth_mac") == 0) {
-                    valueToReturn = "AA:BB:CC:DD:EE:FF";
-                } else if (strcmp(strFmt, "/lib/rdk/getDeviceDetails.sh read estb_mac") == 0) {
-                    valueToReturn = "11:22:33:44:55:66";
-                } else if (strcmp(strFmt, "/lib/rdk/getDeviceDetails.sh read wifi_mac") == 0) {
-                    valueToReturn = "00:11:22:33:44:55";
-                } else if (strcmp(strFmt, "/lib/rdk/getDeviceDetails.sh read estb_ip") == 0) {
-                    valueToReturn = "192.168.1.100";
-                }
-                
-                if (valueToReturn != nullptr) {
-                    return fmemopen(strdup(valueToReturn), strlen(valueToReturn), "r");
-                }
-                
-                return nullptr;
-            }));
+    InstallDeviceDetailsScript("case \"$2\" in\n"
+        "eth_mac) echo \"AA:BB:CC:DD:EE:FF\" ;;\n"
+        "estb_mac) echo \"11:22:33:44:55:66\" ;;\n"
+        "wifi_mac) echo \"00:11:22:33:44:55\" ;;\n"
+        "estb_ip) echo \"192.168.1.100\" ;;\n"
+        "*) exit 1 ;;\n"
+        "esac\n");
 
     /****************** ethmac ******************/
     {
@@ -1606,54 +1641,50 @@ TEST_F(DeviceInfo_L2test, DeviceInfo_JsonRpc_MacAddressesAndIp)
     }
 
     TEST_LOG("DeviceInfo L2 JsonRpc MAC Addresses and IP Tests completed\n");
+
+    RemoveDeviceDetailsScript();
 }
 
 TEST_F(DeviceInfo_L2test, DeviceInfo_JsonRpc_MacAddressesAndIp_Negative)
 {
     TEST_LOG("Starting DeviceInfo L2 JsonRpc MAC Addresses and IP Negative Tests\n");
 
-    /****************** Test with v_secure_popen returning nullptr ******************/
+    /****************** Test with the script missing ******************/
     {
-        TEST_LOG("Testing MAC/IP properties with v_secure_popen failure\n");
+        TEST_LOG("Testing MAC/IP properties with getDeviceDetails.sh missing\n");
         
-        ON_CALL(*p_wrapsImplMock, v_secure_popen(::testing::_, ::testing::_, ::testing::_))
-            .WillByDefault(::testing::Return(nullptr));
+        RemoveDeviceDetailsScript();
 
         // Test ethmac
         JsonObject getResults1;
         uint32_t getResult1 = InvokeServiceMethod(DEVICEINFO_CALLSIGN, "ethmac@0", getResults1);
         EXPECT_EQ(Core::ERROR_GENERAL, getResult1);
-        TEST_LOG("ethmac with popen failure: PASS\n");
+        TEST_LOG("ethmac with script missing: PASS\n");
 
         // Test estbmac
         JsonObject getResults2;
         uint32_t getResult2 = InvokeServiceMethod(DEVICEINFO_CALLSIGN, "estbmac@0", getResults2);
         EXPECT_EQ(Core::ERROR_GENERAL, getResult2);
-        TEST_LOG("estbmac with popen failure: PASS\n");
+        TEST_LOG("estbmac with script missing: PASS\n");
 
         // Test wifimac
         JsonObject getResults3;
         uint32_t getResult3 = InvokeServiceMethod(DEVICEINFO_CALLSIGN, "wifimac@0", getResults3);
         EXPECT_EQ(Core::ERROR_GENERAL, getResult3);
-        TEST_LOG("wifimac with popen failure: PASS\n");
+        TEST_LOG("wifimac with script missing: PASS\n");
 
         // Test estbip
         JsonObject getResults4;
         uint32_t getResult4 = InvokeServiceMethod(DEVICEINFO_CALLSIGN, "estbip@0", getResults4);
         EXPECT_EQ(Core::ERROR_GENERAL, getResult4);
-        TEST_LOG("estbip with popen failure: PASS\n");
+        TEST_LOG("estbip with script missing: PASS\n");
     }
 
     /****************** Test with empty responses ******************/
     {
         TEST_LOG("Testing MAC/IP properties with empty responses\n");
         
-        ON_CALL(*p_wrapsImplMock, v_secure_popen(::testing::_, ::testing::_, ::testing::_))
-            .WillByDefault(::testing::Invoke(
-                [](const char* type, const char* command, va_list args) -> FILE* {
-                    const char* emptyData = "";
-                    return fmemopen(strdup(emptyData), strlen(emptyData), "r");
-                }));
+        InstallDeviceDetailsScript("exit 0\n");
 
         // Test ethmac with empty response
         JsonObject getResults1;
@@ -1704,28 +1735,13 @@ TEST_F(DeviceInfo_L2test, DeviceInfo_JsonRpc_MacAddressesAndIp_Negative)
     {
         TEST_LOG("Testing MAC/IP properties with malformed data\n");
         
-        ON_CALL(*p_wrapsImplMock, v_secure_popen(::testing::_, ::testing::_, ::testing::_))
-            .WillByDefault(::testing::Invoke(
-                [](const char* type, const char* command, va_list args) -> FILE* {
-                    char buffer[256];
-                    vsnprintf(buffer, sizeof(buffer), command, args);
-                    std::string cmd(buffer);
-
-                    const char* data = nullptr;
-                    if (cmd.find("read eth_mac") != std::string::npos) {
-                        data = "INVALID_MAC_FORMAT\n";
-                    } else if (cmd.find("read estb_mac") != std::string::npos) {
-                        data = "ZZ:YY:XX:WW:VV:UU\n";
-                    } else if (cmd.find("read wifi_mac") != std::string::npos) {
-                        data = "NOT_A_MAC\n";
-                    } else if (cmd.find("read estb_ip") != std::string::npos) {
-                        data = "999.999.999.999\n";
-                    } else {
-                        data = "\n";
-                    }
-                    
-                    return fmemopen(strdup(data), strlen(data), "r");
-                }));
+        InstallDeviceDetailsScript("case \"$2\" in\n"
+            "eth_mac) echo \"INVALID_MAC_FORMAT\" ;;\n"
+            "estb_mac) echo \"ZZ:YY:XX:WW:VV:UU\" ;;\n"
+            "wifi_mac) echo \"NOT_A_MAC\" ;;\n"
+            "estb_ip) echo \"999.999.999.999\" ;;\n"
+            "*) echo ;;\n"
+            "esac\n");
 
         // Test ethmac with invalid format
         JsonObject getResults1;
@@ -1776,12 +1792,7 @@ TEST_F(DeviceInfo_L2test, DeviceInfo_JsonRpc_MacAddressesAndIp_Negative)
     {
         TEST_LOG("Testing MAC/IP properties with only newline\n");
         
-        ON_CALL(*p_wrapsImplMock, v_secure_popen(::testing::_, ::testing::_, ::testing::_))
-            .WillByDefault(::testing::Invoke(
-                [](const char* type, const char* command, va_list args) -> FILE* {
-                    const char* data = "\n";
-                    return fmemopen(strdup(data), strlen(data), "r");
-                }));
+        InstallDeviceDetailsScript("echo\n");
 
         // Test all properties with only newline
         JsonObject getResults1;
@@ -1808,6 +1819,8 @@ TEST_F(DeviceInfo_L2test, DeviceInfo_JsonRpc_MacAddressesAndIp_Negative)
     }
 
     TEST_LOG("DeviceInfo L2 JsonRpc MAC Addresses and IP Negative Tests completed\n");
+
+    RemoveDeviceDetailsScript();
 }
 
 // ======================= COM-RPC TESTS =======================
@@ -1849,6 +1862,8 @@ TEST_F(DeviceInfo_L2test, DeviceInfo_COMRPC_Make)
                 return IARM_RESULT_SUCCESS;
             });
 
+    RefreshIdentitySnapshot();
+
     Exchange::IDeviceInfo::DeviceMake make;
     Core::hresult rc = m_deviceinfoplugin->Make(make);
     EXPECT_EQ(Core::ERROR_NONE, rc);
@@ -1890,6 +1905,8 @@ TEST_F(DeviceInfo_L2test, DeviceInfo_COMRPC_SocName)
     file << "SOC=NVIDIA\n";
     file.close();
 
+    RefreshIdentitySnapshot();
+
     Exchange::IDeviceInfo::DeviceSoc socName;
     Core::hresult rc = m_deviceinfoplugin->SocName(socName);
     EXPECT_EQ(Core::ERROR_NONE, rc);
@@ -1937,6 +1954,8 @@ TEST_F(DeviceInfo_L2test, DeviceInfo_COMRPC_ChipSet)
     file << "CHIPSET_NAME=TestChipset\n";
     file.close();
 
+    RefreshIdentitySnapshot();
+
     Exchange::IDeviceInfo::DeviceChip chipset;
     Core::hresult rc = m_deviceinfoplugin->ChipSet(chipset);
     EXPECT_EQ(Core::ERROR_NONE, rc);
@@ -2031,34 +2050,13 @@ TEST_F(DeviceInfo_L2test, DeviceInfo_COMRPC_SupportedAudioPorts)
 TEST_F(DeviceInfo_L2test, DeviceInfo_COMRPC_MacAddressesAndIp)
 {
 
-    // Setup v_secure_popen mock for MAC addresses and IP
-    ON_CALL(*p_wrapsImplMock, v_secure_popen(::testing::_, ::testing::_, ::testing::_))
-        .WillByDefault(::testing::Invoke(
-            [](const char* type, const char* command, va_list args) -> FILE* {
-                va_list args2;
-                va_copy(args2, args);
-                char strFmt[256];
-                vsnprintf(strFmt, sizeof(strFmt), command, args2);
-                va_end(args2);
-                
-                const char* valueToReturn = nullptr;
-                
-                if (strcmp(strFmt, "/lib/rdk/getDeviceDetails.sh read eth_mac") == 0) {
-                    valueToReturn = "AA:BB:CC:DD:EE:FF";
-                } else if (strcmp(strFmt, "/lib/rdk/getDeviceDetails.sh read estb_mac") == 0) {
-                    valueToReturn = "11:22:33:44:55:66";
-                } else if (strcmp(strFmt, "/lib/rdk/getDeviceDetails.sh read wifi_mac") == 0) {
-                    valueToReturn = "00:11:22:33:44:55";
-                } else if (strcmp(strFmt, "/lib/rdk/getDeviceDetails.sh read estb_ip") == 0) {
-                    valueToReturn = "192.168.1.100";
-                }
-                
-                if (valueToReturn != nullptr) {
-                    return fmemopen(strdup(valueToReturn), strlen(valueToReturn), "r");
-                }
-                
-                return nullptr;
-            }));
+    InstallDeviceDetailsScript("case \"$2\" in\n"
+        "eth_mac) echo \"AA:BB:CC:DD:EE:FF\" ;;\n"
+        "estb_mac) echo \"11:22:33:44:55:66\" ;;\n"
+        "wifi_mac) echo \"00:11:22:33:44:55\" ;;\n"
+        "estb_ip) echo \"192.168.1.100\" ;;\n"
+        "*) exit 1 ;;\n"
+        "esac\n");
 
     ASSERT_TRUE(m_deviceinfoplugin != nullptr);
 
@@ -2092,4 +2090,5 @@ TEST_F(DeviceInfo_L2test, DeviceInfo_COMRPC_MacAddressesAndIp)
     EXPECT_FALSE(stbIp.estbIp.empty());
     EXPECT_EQ(stbIp.estbIp, "192.168.1.100");
 
+    RemoveDeviceDetailsScript();
 }
@@ -0,0 +1,72 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2026 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+
+#include "AddressFilter.h"
+
+#include <fnmatch.h>
+#include <net/if.h>
+#include <sys/socket.h>
+
+namespace WPEFramework {
+namespace Plugin {
+
+    bool AddressFilter::Family(const string& name)
+    {
+        bool result = true;
+
+        if (name.empty() == true) {
+            family = AF_UNSPEC;
+        } else if (name == _T("ipv4")) {
+            family = AF_INET;
+        } else if (name == _T("ipv6")) {
+            family = AF_INET6;
+        } else {
+            result = false;
+        }
+
+        return result;
+    }
+
+    bool AddressFilter::Keeps(const NetlinkMonitor::Link& link) const
+    {
+        if (((up == true) && ((link.flags & IFF_UP) == 0))
+            || ((pattern.empty() == false) && (fnmatch(pattern.c_str(), link.name.c_str(), 0) != 0))) {
+            return (false);
+        }
+
+        if (hasAddress == true) {
+            for (const NetlinkMonitor::Address& address : link.addresses) {
+                if (Matches(address) == true) {
+                    return (true);
+                }
+            }
+            return (false);
+        }
+
+        return (true);
+    }
+
+    bool AddressFilter::Matches(const NetlinkMonitor::Address& address) const
+    {
+        return ((family == AF_UNSPEC) || (address.family == family));
+    }
+
+} // namespace Plugin
+} // namespace WPEFramework
@@ -0,0 +1,60 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2026 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+
+#pragma once
+
+#include "Module.h"
+#include "NetlinkMonitor.h"
+
+#include <sys/socket.h>
+
+namespace WPEFramework {
+namespace Plugin {
+
+    // Selection applied to the interface model before anything is marshalled,
+    // so the size of an Addresses() or networkaddresses answer depends on what
+    // the client asked for rather than on the number of (container) interfaces.
+    // Every criterion is optional; a default constructed filter selects all.
+    struct AddressFilter {
+        AddressFilter()
+            : pattern()
+            , up(false)
+            , hasAddress(false)
+            , family(AF_UNSPEC)
+        {
+        }
+
+        // "ipv4", "ipv6" or empty; anything else is rejected.
+        bool Family(const string& name);
+
+        // Whether the link is selected: name glob (fnmatch), the up flag and,
+        // with hasAddress, at least one address of the selected family. The
+        // one definition behind both Addresses() and networkaddresses.
+        bool Keeps(const NetlinkMonitor::Link& link) const;
+        bool Matches(const NetlinkMonitor::Address& address) const;
+
+        string pattern;
+        bool up;
+        bool hasAddress;
+        uint8_t family; // AF_UNSPEC, AF_INET or AF_INET6
+    };
+
+} // namespace Plugin
+} // namespace WPEFramework
@@ -0,0 +1,118 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2026 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+
+#include "CircuitBreaker.h"
+
+namespace WPEFramework {
+namespace Plugin {
+
+    CircuitBreaker::CircuitBreaker(const string& name)
+        : _name(name)
+        , _adminLock()
+        , _threshold(0)
+        , _openTime(0)
+        , _state(CLOSED)
+        , _failures(0)
+        , _openUntil(0)
+    {
+    }
+
+    void CircuitBreaker::Configure(const uint32_t failureThreshold, const uint32_t openTime)
+    {
+        _adminLock.Lock();
+        _threshold = failureThreshold;
+        _openTime = static_cast<uint64_t>(openTime) * Core::Time::TicksPerMillisecond;
+        _state = CLOSED;
+        _failures = 0;
+        _adminLock.Unlock();
+    }
+
+    bool CircuitBreaker::Allow()
+    {
+        bool result = true;
+
+        _adminLock.Lock();
+
+        if (_threshold > 0) {
+            if (_state == OPEN) {
+                if (Core::Time::Now().Ticks() >= _openUntil) {
+                    TRACE(Trace::Information, (_T("%s circuit half-open, probing"), _name.c_str()));
+                    _state = HALF_OPEN;
+                } else {
+                    result = false;
+                }
+            } else if (_state == HALF_OPEN) {
+                // Only the probe is let through until it reported back.
+                result = false;
+            }
+        }
+
+        _adminLock.Unlock();
+
+        return (result);
+    }
+
+    void CircuitBreaker::Success()
+    {
+        _adminLock.Lock();
+
+        if (_state != CLOSED) {
+            TRACE(Trace::Information, (_T("%s circuit closed"), _name.c_str()));
+            _state = CLOSED;
+        }
+        _failures = 0;
+
+        _adminLock.Unlock();
+    }
+
+    void CircuitBreaker::Failure()
+    {
+        _adminLock.Lock();
+
+        if (_threshold > 0) {
+            if (_state == HALF_OPEN) {
+                Open(Core::Time::Now().Ticks());
+            } else if ((_state == CLOSED) && (++_failures >= _threshold)) {
+                Open(Core::Time::Now().Ticks());
+            }
+        }
+
+        _adminLock.Unlock();
+    }
+
+    CircuitBreaker::state CircuitBreaker::State() const
+    {
+        _adminLock.Lock();
+        const state result = _state;
+        _adminLock.Unlock();
+
+        return (result);
+    }
+
+    void CircuitBreaker::Open(const uint64_t now)
+    {
+        TRACE(Trace::Error, (_T("%s circuit open, failing fast for %llu ms"), _name.c_str(), static_cast<unsigned long long>(_openTime / Core::Time::TicksPerMillisecond)));
+        _state = OPEN;
+        _failures = 0;
+        _openUntil = now + _openTime;
+    }
+
+} // namespace Plugin
+} // namespace WPEFramework
@@ -0,0 +1,71 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2026 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+
+#pragma once
+
+#include "Module.h"
+
+namespace WPEFramework {
+namespace Plugin {
+
+    // Fails calls to a backend fast once it stopped answering. After
+    // FailureThreshold consecutive failures the breaker opens and rejects
+    // calls for the open time; then a single probe call is let through
+    // (half-open) and its outcome either closes the breaker or re-opens it.
+    // Every call admitted by Allow() must be reported with Success() or Failure().
+    class CircuitBreaker {
+    public:
+        enum state : uint8_t {
+            CLOSED,
+            OPEN,
+            HALF_OPEN
+        };
+
+        CircuitBreaker(const CircuitBreaker&) = delete;
+        CircuitBreaker& operator=(const CircuitBreaker&) = delete;
+
+        explicit CircuitBreaker(const string& name);
+        ~CircuitBreaker() = default;
+
+    public:
+        // A threshold of 0 disables the breaker.
+        void Configure(const uint32_t failureThreshold, const uint32_t openTime);
+
+        bool Allow();
+        void Success();
+        void Failure();
+
+        state State() const;
+
+    private:
+        void Open(const uint64_t now);
+
+    private:
+        const string _name;
+        mutable Core::CriticalSection _adminLock;
+        uint32_t _threshold;
+        uint64_t _openTime;
+        state _state;
+        uint32_t _failures;
+        uint64_t _openUntil;
+    };
+
+} // namespace Plugin
+} // namespace WPEFramework
@@ -23,14 +23,84 @@
 #include "host.hpp"
 #include "manager.hpp"
 
+#include "dsMgr.h"
+
 #include "UtilsIarm.h"
 
 namespace WPEFramework {
 namespace Plugin {
 
+    namespace {
+
+        // DS events after which a port may report different capabilities.
+        const IARM_EventId_t InvalidatingEvents[] = {
+            IARM_BUS_DSMGR_EVENT_HDMI_HOTPLUG,
+            IARM_BUS_DSMGR_EVENT_AUDIO_OUT_HOTPLUG,
+            IARM_BUS_DSMGR_EVENT_AUDIO_MODE,
+            IARM_BUS_DSMGR_EVENT_ATMOS_CAPS_CHANGED
+        };
+
+        // Every live instance. The lock is held across Invalidate(), so an
+        // instance leaving the registry is never used by a DS event again.
+        struct Registry {
+            Core::CriticalSection lock;
+            std::list<DeviceAudioCapabilities*> instances;
+        };
+
+        Registry& Instances()
+        {
+            static Registry registry;
+            return (registry);
+        }
+
+        // Runs one DS call; false, after tracing it, when it threw.
+        template <typename ACTION>
+        bool Guarded(ACTION action)
+        {
+            bool result = false;
+
+            try {
+                action();
+                result = true;
+            } catch (const device::Exception& e) {
+                TRACE_GLOBAL(Trace::Fatal, (_T("Exception caught %s"), e.what()));
+            } catch (const std::exception& e) {
+                TRACE_GLOBAL(Trace::Fatal, (_T("Exception caught %s"), e.what()));
+            } catch (...) {
+            }
+
+            return (result);
+        }
+    }
+
+    // The IARM handler for InvalidatingEvents, passed on to every live instance.
+    class DsEvents {
+    public:
+        static void Handler(const char* owner, IARM_EventId_t eventId, void*, size_t)
+        {
+            if ((owner != nullptr) && (strcmp(owner, IARM_BUS_DSMGR_NAME) == 0)) {
+                Registry& registry(Instances());
+
+                registry.lock.Lock();
+                if (registry.instances.empty() == false) {
+                    TRACE_GLOBAL(Trace::Information, (_T("DS event %d, dropping the cached audio capabilities"), static_cast<int>(eventId)));
+                }
+                for (DeviceAudioCapabilities* instance : registry.instances) {
+                    instance->Invalidate();
+                }
+                registry.lock.Unlock();
+            }
+        }
+    };
+
     SERVICE_REGISTRATION(DeviceAudioCapabilities, 1, 0);
 
     DeviceAudioCapabilities::DeviceAudioCapabilities()
+        : _singleFlight()
+        , _cacheLock()
+        , _cache()
+        , _defaultPort()
+        , _generation(0)
     {
         Utils::IARM::init();
 
@@ -42,30 +112,188 @@ namespace Plugin {
             TRACE(Trace::Fatal, (_T("Exception caught %s"), e.what()));
         } catch (...) {
         }
+
+        Registry& registry(Instances());
+        registry.lock.Lock();
+        registry.instances.push_back(this);
+        registry.lock.Unlock();
+
+        for (const IARM_EventId_t event : InvalidatingEvents) {
+            if (IARM_Bus_RegisterEventHandler(IARM_BUS_DSMGR_NAME, event, DsEvents::Handler) != IARM_RESULT_SUCCESS) {
+                TRACE(Trace::Error, (_T("Could not subscribe to DS event %d, audio capabilities may be stale"), static_cast<int>(event)));
+            }
+        }
     }
 
-    Core::hresult DeviceAudioCapabilities::AudioCapabilities(const string& audioPort, Exchange::IDeviceAudioCapabilities::IAudioCapabilityIterator*& audioCapabilities, bool& success) const
+    DeviceAudioCapabilities::~DeviceAudioCapabilities()
+    {
+        for (const IARM_EventId_t event : InvalidatingEvents) {
+            IARM_Bus_RemoveEventHandler(IARM_BUS_DSMGR_NAME, event, DsEvents::Handler);
+        }
+
+        // Waits for a DS event that is still invalidating this instance.
+        Registry& registry(Instances());
+        registry.lock.Lock();
+        registry.instances.remove(this);
+        registry.lock.Unlock();
+    }
+
+    void DeviceAudioCapabilities::Invalidate()
     {
+        _cacheLock.Lock();
+        _generation++;
+        _cache.clear();
+        _defaultPort.clear();
+        _cacheLock.Unlock();
+    }
+
+    uint32_t DeviceAudioCapabilities::ResolvePort(const string& audioPort, string& name) const
+    {
+        if (audioPort.empty() == false) {
+            name = audioPort;
+            return (Core::ERROR_NONE);
+        }
+
+        _cacheLock.Lock();
+        name = _defaultPort;
+        const uint32_t generation = _generation;
+        _cacheLock.Unlock();
+
         uint32_t result = Core::ERROR_NONE;
 
+        if (name.empty() == true) {
+            try {
+                name = device::Host::getInstance().getDefaultAudioPortName();
+            } catch (const device::Exception& e) {
+                TRACE(Trace::Fatal, (_T("Exception caught %s"), e.what()));
+                result = Core::ERROR_GENERAL;
+            } catch (const std::exception& e) {
+                TRACE(Trace::Fatal, (_T("Exception caught %s"), e.what()));
+                result = Core::ERROR_GENERAL;
+            } catch (...) {
+                result = Core::ERROR_GENERAL;
+            }
+
+            if (result == Core::ERROR_NONE) {
+                _cacheLock.Lock();
+                if (generation == _generation) {
+                    _defaultPort = name;
+                }
+                _cacheLock.Unlock();
+            }
+        }
+
+        return (result);
+    }
+
+    bool DeviceAudioCapabilities::Cached(const string& name, const cached what, PortCapabilities& capabilities) const
+    {
+        _cacheLock.Lock();
+
+        auto entry = _cache.find(name);
+        if (entry != _cache.end()) {
+            capabilities = entry->second;
+        } else {
+            capabilities = PortCapabilities { dsAUDIOSUPPORT_NONE, dsMS12SUPPORT_NONE, {}, 0 };
+        }
+
+        _cacheLock.Unlock();
+
+        return ((capabilities.known & what) != 0);
+    }
+
+    /* static */ void DeviceAudioCapabilities::Merge(PortCapabilities& into, const PortCapabilities& from)
+    {
+        if ((from.known & CACHED_AUDIO) != 0) {
+            into.audio = from.audio;
+        }
+        if ((from.known & CACHED_MS12) != 0) {
+            into.ms12 = from.ms12;
+        }
+        if ((from.known & CACHED_PROFILES) != 0) {
+            into.profiles = from.profiles;
+        }
+        into.known |= from.known;
+    }
+
+    void DeviceAudioCapabilities::Store(const string& name, const uint32_t generation, const PortCapabilities& capabilities) const
+    {
+        _cacheLock.Lock();
+
+        if (generation == _generation) {
+            Merge(_cache.emplace(name, PortCapabilities { dsAUDIOSUPPORT_NONE, dsMS12SUPPORT_NONE, {}, 0 }).first->second, capabilities);
+        }
+
+        _cacheLock.Unlock();
+    }
+
+    // A miss reads every answer of the port that is not cached yet through
+    // one getAudioOutputPort() and caches each that DS gave. The other
+    // getters, e.g. for the audio capability matrix, are then served from the
+    // cache, and a getter that threw is retried on its own.
+    uint32_t DeviceAudioCapabilities::QueryPort(const string& audioPort, const cached what, PortCapabilities& capabilities) const
+    {
+        const uint32_t generation = _generation;
+        string name;
+
+        uint32_t result = ResolvePort(audioPort, name);
+
+        if ((result == Core::ERROR_NONE) && (Cached(name, what, capabilities) == false)) {
+            device::AudioOutputPort* port = nullptr;
+            PortCapabilities fetched { dsAUDIOSUPPORT_NONE, dsMS12SUPPORT_NONE, {}, 0 };
+
+            if (Guarded([&]() { port = &device::Host::getInstance().getAudioOutputPort(name); }) == true) {
+                int value = dsAUDIOSUPPORT_NONE;
+                if (((capabilities.known & CACHED_AUDIO) == 0) && (Guarded([&]() { port->getAudioCapabilities(&value); }) == true)) {
+                    fetched.audio = value;
+                    fetched.known |= CACHED_AUDIO;
+                }
+                value = dsMS12SUPPORT_NONE;
+                if (((capabilities.known & CACHED_MS12) == 0) && (Guarded([&]() { port->getMS12Capabilities(&value); }) == true)) {
+                    fetched.ms12 = value;
+                    fetched.known |= CACHED_MS12;
+                }
+                if ((capabilities.known & CACHED_PROFILES) == 0) {
+                    Guarded([&]() {
+                        const auto profiles = port->getMS12AudioProfileList();
+                        fetched.profiles.assign(profiles.begin(), profiles.end());
+                        fetched.known |= CACHED_PROFILES;
+                    });
+                }
+
+                Store(name, generation, fetched);
+                Merge(capabilities, fetched);
+            }
+
+            if ((capabilities.known & what) == 0) {
+                result = Core::ERROR_GENERAL;
+            }
+        }
+
+        return (result);
+    }
+
+    Core::hresult DeviceAudioCapabilities::AudioCapabilities(const string& audioPort, Exchange::IDeviceAudioCapabilities::IAudioCapabilityIterator*& audioCapabilities, bool& success) const
+    {
         std::list<Exchange::IDeviceAudioCapabilities::AudioCapability> list;
 
-        int capabilities = dsAUDIOSUPPORT_NONE;
+        const uint32_t result = _singleFlight.Do(_T("audiocapabilities@") + audioPort, list, [this, &audioPort](std::list<Exchange::IDeviceAudioCapabilities::AudioCapability>& capabilities) { return (QueryAudioCapabilities(audioPort, capabilities)); });
 
-        try {
-            auto strAudioPort = audioPort.empty() ? device::Host::getInstance().getDefaultAudioPortName() : audioPort;
-            auto& aPort = device::Host::getInstance().getAudioOutputPort(strAudioPort);
-            aPort.getAudioCapabilities(&capabilities);
-        } catch (const device::Exception& e) {
-            TRACE(Trace::Fatal, (_T("Exception caught %s"), e.what()));
-            result = Core::ERROR_GENERAL;
-        } catch (const std::exception& e) {
-            TRACE(Trace::Fatal, (_T("Exception caught %s"), e.what()));
-            result = Core::ERROR_GENERAL;
-        } catch (...) {
-            result = Core::ERROR_GENERAL;
+        if (result == Core::ERROR_NONE) {
+            audioCapabilities = (Core::Service<RPC::IteratorType<Exchange::IDeviceAudioCapabilities::IAudioCapabilityIterator>>::Create<Exchange::IDeviceAudioCapabilities::IAudioCapabilityIterator>(list));
+            success = true;
         }
 
+        return result;
+    }
+
+    uint32_t DeviceAudioCapabilities::QueryAudioCapabilities(const string& audioPort, std::list<Exchange::IDeviceAudioCapabilities::AudioCapability>& list) const
+    {
+        PortCapabilities port {};
+
+        const uint32_t result = QueryPort(audioPort, CACHED_AUDIO, port);
+        const int capabilities = (result == Core::ERROR_NONE) ? port.audio : dsAUDIOSUPPORT_NONE;
+
         if (!capabilities)
             list.emplace_back(Exchange::IDeviceAudioCapabilities::AudioCapability::AUDIOCAPABILITY_NONE);
         if (capabilities & dsAUDIOSUPPORT_ATMOS)
@@ -81,36 +309,30 @@ namespace Plugin {
         if (capabilities & dsAUDIOSUPPORT_MS12)
             list.emplace_back(Exchange::IDeviceAudioCapabilities::AudioCapability::MS12);
 
-        if (result == Core::ERROR_NONE) {
-            audioCapabilities = (Core::Service<RPC::IteratorType<Exchange::IDeviceAudioCapabilities::IAudioCapabilityIterator>>::Create<Exchange::IDeviceAudioCapabilities::IAudioCapabilityIterator>(list));
-            success = true;
-        }
-
         return result;
     }
 
     Core::hresult DeviceAudioCapabilities::MS12Capabilities(const string& audioPort, Exchange::IDeviceAudioCapabilities::IMS12CapabilityIterator*& ms12Capabilities, bool& success) const
     {
-        uint32_t result = Core::ERROR_NONE;
-
         std::list<Exchange::IDeviceAudioCapabilities::MS12Capability> list;
 
-        int capabilities = dsMS12SUPPORT_NONE;
+        const uint32_t result = _singleFlight.Do(_T("ms12capabilities@") + audioPort, list, [this, &audioPort](std::list<Exchange::IDeviceAudioCapabilities::MS12Capability>& capabilities) { return (QueryMS12Capabilities(audioPort, capabilities)); });
 
-        try {
-            auto strAudioPort = audioPort.empty() ? device::Host::getInstance().getDefaultAudioPortName() : audioPort;
-            auto& aPort = device::Host::getInstance().getAudioOutputPort(strAudioPort);
-            aPort.getMS12Capabilities(&capabilities);
-        } catch (const device::Exception& e) {
-            TRACE(Trace::Fatal, (_T("Exception caught %s"), e.what()));
-            result = Core::ERROR_GENERAL;
-        } catch (const std::exception& e) {
-            TRACE(Trace::Fatal, (_T("Exception caught %s"), e.what()));
-            result = Core::ERROR_GENERAL;
-        } catch (...) {
-            result = Core::ERROR_GENERAL;
+        if (result == Core::ERROR_NONE) {
+            ms12Capabilities = (Core::Service<RPC::IteratorType<Exchange::IDeviceAudioCapabilities::IMS12CapabilityIterator>>::Create<Exchange::IDeviceAudioCapabilities::IMS12CapabilityIterator>(list));
+            success = true;
         }
 
+        return result;
+    }
+
+    uint32_t DeviceAudioCapabilities::QueryMS12Capabilities(const string& audioPort, std::list<Exchange::IDeviceAudioCapabilities::MS12Capability>& list) const
+    {
+        PortCapabilities port {};
+
+        const uint32_t result = QueryPort(audioPort, CACHED_MS12, port);
+        const int capabilities = (result == Core::ERROR_NONE) ? port.ms12 : dsMS12SUPPORT_NONE;
+
         if (!capabilities)
             list.emplace_back(Exchange::IDeviceAudioCapabilities::MS12Capability::MS12CAPABILITY_NONE);
         if (capabilities & dsMS12SUPPORT_DolbyVolume)
@@ -120,36 +342,14 @@ namespace Plugin {
         if (capabilities & dsMS12SUPPORT_DialogueEnhancer)
             list.emplace_back(Exchange::IDeviceAudioCapabilities::MS12Capability::DIALOGUEENHANCER);
 
-        if (result == Core::ERROR_NONE) {
-            ms12Capabilities = (Core::Service<RPC::IteratorType<Exchange::IDeviceAudioCapabilities::IMS12CapabilityIterator>>::Create<Exchange::IDeviceAudioCapabilities::IMS12CapabilityIterator>(list));
-            success = true;
-        }
-
         return result;
     }
 
     Core::hresult DeviceAudioCapabilities::SupportedMS12AudioProfiles(const string& audioPort, RPC::IStringIterator*& supportedMS12AudioProfiles, bool& success) const
     {
-        uint32_t result = Core::ERROR_NONE;
-
         std::list<string> list;
 
-        try {
-            auto strAudioPort = audioPort.empty() ? device::Host::getInstance().getDefaultAudioPortName() : audioPort;
-            auto& aPort = device::Host::getInstance().getAudioOutputPort(strAudioPort);
-            const auto supportedProfiles = aPort.getMS12AudioProfileList();
-            for (size_t i = 0; i < supportedProfiles.size(); i++) {
-                list.emplace_back(supportedProfiles.at(i));
-            }
-        } catch (const device::Exception& e) {
-            TRACE(Trace::Fatal, (_T("Exception caught %s"), e.what()));
-            result = Core::ERROR_GENERAL;
-        } catch (const std::exception& e) {
-            TRACE(Trace::Fatal, (_T("Exception caught %s"), e.what()));
-            result = Core::ERROR_GENERAL;
-        } catch (...) {
-            result = Core::ERROR_GENERAL;
-        }
+        const uint32_t result = _singleFlight.Do(_T("supportedms12audioprofiles@") + audioPort, list, [this, &audioPort](std::list<string>& profiles) { return (QueryMS12AudioProfiles(audioPort, profiles)); });
 
         if (result == Core::ERROR_NONE) {
             supportedMS12AudioProfiles = (Core::Service<RPC::StringIterator>::Create<RPC::IStringIterator>(list));
@@ -158,5 +358,18 @@ namespace Plugin {
 
         return result;
     }
+
+    uint32_t DeviceAudioCapabilities::QueryMS12AudioProfiles(const string& audioPort, std::list<string>& list) const
+    {
+        PortCapabilities port {};
+
+        const uint32_t result = QueryPort(audioPort, CACHED_PROFILES, port);
+
+        if (result == Core::ERROR_NONE) {
+            list.assign(port.profiles.begin(), port.profiles.end());
+        }
+
+        return result;
+    }
 }
 }
@@ -20,6 +20,12 @@
 #pragma once
 
 #include "Module.h"
+#include "SingleFlight.h"
+
+#include <atomic>
+#include <list>
+#include <map>
+#include <vector>
 #include <interfaces/IDeviceInfo.h>
 
 namespace WPEFramework {
@@ -31,16 +37,63 @@ namespace Plugin {
 
     public:
         DeviceAudioCapabilities();
+        ~DeviceAudioCapabilities() override;
 
         BEGIN_INTERFACE_MAP(DeviceAudioCapabilities)
         INTERFACE_ENTRY(Exchange::IDeviceAudioCapabilities)
         END_INTERFACE_MAP
 
     private:
+        friend class DsEvents;
+
         // IDeviceAudioCapabilities interface
         Core::hresult AudioCapabilities(const string& audioPort, Exchange::IDeviceAudioCapabilities::IAudioCapabilityIterator*& audioCapabilities, bool& success) const override;
         Core::hresult MS12Capabilities(const string& audioPort, Exchange::IDeviceAudioCapabilities::IMS12CapabilityIterator*& ms12Capabilities, bool& success) const override;
         Core::hresult SupportedMS12AudioProfiles(const string& audioPort, RPC::IStringIterator*& supportedMS12AudioProfiles, bool& success) const override;
+
+    private:
+        // Drops every cached port answer; called by DsEvents for DS HDMI, audio
+        // output (ARC/eARC) hotplug, audio mode and ATMOS capability events.
+        void Invalidate();
+
+        // DS queries behind the getters; concurrent callers for the same port share one of them.
+        uint32_t QueryAudioCapabilities(const string& audioPort, std::list<Exchange::IDeviceAudioCapabilities::AudioCapability>& list) const;
+        uint32_t QueryMS12Capabilities(const string& audioPort, std::list<Exchange::IDeviceAudioCapabilities::MS12Capability>& list) const;
+        uint32_t QueryMS12AudioProfiles(const string& audioPort, std::list<string>& list) const;
+
+    private:
+        enum cached : uint8_t {
+            CACHED_AUDIO = 0x01,
+            CACHED_MS12 = 0x02,
+            CACHED_PROFILES = 0x04
+        };
+
+        struct PortCapabilities {
+            int audio; // dsAUDIOSUPPORT_*
+            int ms12; // dsMS12SUPPORT_*
+            std::vector<string> profiles;
+            uint8_t known; // cached
+        };
+
+        // The requested port, or the DS default port when it is empty.
+        uint32_t ResolvePort(const string& audioPort, string& name) const;
+        // Copies what is cached for the port; true when that includes what.
+        bool Cached(const string& name, const cached what, PortCapabilities& capabilities) const;
+        // Takes over the answers marked known in from.
+        static void Merge(PortCapabilities& into, const PortCapabilities& from);
+        // Stores the answers marked known; ignored when an invalidation happened since generation was taken.
+        void Store(const string& name, const uint32_t generation, const PortCapabilities& capabilities) const;
+        // The port's capabilities with at least what known, from the cache or one DS port lookup
+        // that fetches every answer not cached yet.
+        uint32_t QueryPort(const string& audioPort, const cached what, PortCapabilities& capabilities) const;
+
+    private:
+        mutable SingleFlight _singleFlight;
+        // DS answers per resolved port name, kept until DS reports a change.
+        mutable Core::CriticalSection _cacheLock;
+        mutable std::map<string, PortCapabilities> _cache;
+        mutable string _defaultPort;
+        std::atomic<uint32_t> _generation;
     };
 }
 }
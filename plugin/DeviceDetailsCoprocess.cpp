@@ -0,0 +1,229 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2026 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+#include "DeviceDetailsCoprocess.h"
+#include "ScriptExecutor.h"
+
+#include <cstdlib>
+#include <poll.h>
+#include <signal.h>
+#include <spawn.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+extern char** environ;
+
+namespace WPEFramework {
+namespace Plugin {
+    namespace {
+
+        // $1 is the script. Every answer ends with RS (\036), the exit code and a newline.
+        constexpr TCHAR HelperLoop[] = _T("while IFS= read -r field; do \"$1\" read \"$field\" </dev/null; printf '\\036%d\\n' \"$?\"; done");
+
+        constexpr char Separator = '\036';
+    }
+
+    DeviceDetailsCoprocess::DeviceDetailsCoprocess()
+        : _script()
+        , _adminLock()
+        , _timeout(5000)
+        , _maxRestarts(5)
+        , _restartWindow(60000 * Core::Time::TicksPerMillisecond)
+        , _restarts(0)
+        , _windowStart(0)
+        , _pid(-1)
+        , _channel(-1)
+        , _buffer()
+    {
+    }
+
+    DeviceDetailsCoprocess::~DeviceDetailsCoprocess()
+    {
+        Stop();
+    }
+
+    void DeviceDetailsCoprocess::Configure(const string& script, const uint32_t timeout, const uint8_t maxRestarts, const uint32_t restartWindow)
+    {
+        _adminLock.Lock();
+        _script = script;
+        _timeout = timeout;
+        _maxRestarts = maxRestarts;
+        _restartWindow = static_cast<uint64_t>(restartWindow) * Core::Time::TicksPerMillisecond;
+        _adminLock.Unlock();
+    }
+
+    void DeviceDetailsCoprocess::Stop()
+    {
+        _adminLock.Lock();
+        Kill();
+        _restarts = 0;
+        _windowStart = 0;
+        _adminLock.Unlock();
+    }
+
+    uint32_t DeviceDetailsCoprocess::Read(const string& field, string& value)
+    {
+        uint32_t result = Core::ERROR_GENERAL;
+
+        _adminLock.Lock();
+
+        if ((_pid < 0) && (Spawn() == false)) {
+            result = Core::ERROR_UNAVAILABLE;
+        } else {
+            const string request(field + '\n');
+
+            if (send(_channel, request.c_str(), request.length(), MSG_NOSIGNAL) != static_cast<ssize_t>(request.length())) {
+                TRACE(Trace::Error, (_T("Device details helper is gone: %d"), errno));
+                Kill();
+                result = Core::ERROR_UNAVAILABLE;
+            } else {
+                const uint64_t deadline = Core::Time::Now().Ticks() + (static_cast<uint64_t>(_timeout) * Core::Time::TicksPerMillisecond);
+                size_t separator = string::npos;
+
+                while (result == Core::ERROR_GENERAL) {
+                    separator = _buffer.find(Separator);
+                    if ((separator != string::npos) && (_buffer.find('\n', separator) != string::npos)) {
+                        break;
+                    }
+
+                    const uint64_t now = Core::Time::Now().Ticks();
+                    struct pollfd descriptor = { _channel, POLLIN, 0 };
+                    const int ready = (now < deadline)
+                        ? poll(&descriptor, 1, static_cast<int>((deadline - now + Core::Time::TicksPerMillisecond - 1) / Core::Time::TicksPerMillisecond))
+                        : 0;
+
+                    if (ready == 0) {
+                        result = Core::ERROR_TIMEDOUT;
+                    } else if (ready < 0) {
+                        result = (errno == EINTR) ? Core::ERROR_GENERAL : Core::ERROR_UNAVAILABLE;
+                    } else {
+                        char chunk[256];
+                        const ssize_t received = recv(_channel, chunk, sizeof(chunk), 0);
+                        if (received > 0) {
+                            _buffer.append(chunk, received);
+                            if (_buffer.length() > (ScriptExecutor::MaxOutput + 8)) {
+                                TRACE(Trace::Error, (_T("Device details helper wrote too much for %s"), field.c_str()));
+                                result = Core::ERROR_UNAVAILABLE;
+                            }
+                        } else if ((received == 0) || (errno != EINTR)) {
+                            result = Core::ERROR_UNAVAILABLE;
+                        }
+                    }
+                }
+
+                if ((result == Core::ERROR_TIMEDOUT) || (result == Core::ERROR_UNAVAILABLE)) {
+                    // The stream is out of step with the requests now, start over.
+                    TRACE(Trace::Error, (_T("Device details helper failed reading %s: %u"), field.c_str(), result));
+                    Kill();
+                } else {
+                    const size_t end = _buffer.find('\n', separator);
+                    const int status = atoi(_buffer.substr(separator + 1, end - separator - 1).c_str());
+
+                    if (status != 0) {
+                        TRACE(Trace::Error, (_T("Device details script failed reading %s: %d"), field.c_str(), status));
+                    } else {
+                        value.assign(_buffer, 0, separator);
+
+                        // Remove trailing newline if present
+                        if (!value.empty() && value.back() == '\n') {
+                            value.pop_back();
+                        }
+                        result = Core::ERROR_NONE;
+                    }
+                    _buffer.erase(0, end + 1);
+                }
+            }
+        }
+
+        _adminLock.Unlock();
+
+        return result;
+    }
+
+    bool DeviceDetailsCoprocess::Spawn()
+    {
+        const uint64_t now = Core::Time::Now().Ticks();
+
+        if ((_windowStart == 0) || ((now - _windowStart) >= _restartWindow)) {
+            _windowStart = now;
+            _restarts = 0;
+        }
+        if (_restarts >= _maxRestarts) {
+            return false;
+        }
+        _restarts++;
+
+        int channels[2];
+        if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, channels) != 0) {
+            TRACE(Trace::Error, (_T("Could not create the helper channel: %d"), errno));
+            return false;
+        }
+
+        posix_spawn_file_actions_t actions;
+        posix_spawnattr_t attributes;
+        posix_spawn_file_actions_init(&actions);
+        posix_spawn_file_actions_adddup2(&actions, channels[1], STDIN_FILENO);
+        posix_spawn_file_actions_adddup2(&actions, channels[1], STDOUT_FILENO);
+        posix_spawnattr_init(&attributes);
+        // Own process group, so a timed out script is killed together with the helper.
+        posix_spawnattr_setflags(&attributes, POSIX_SPAWN_SETPGROUP);
+        posix_spawnattr_setpgroup(&attributes, 0);
+
+        char* const arguments[] = { const_cast<char*>("/bin/sh"), const_cast<char*>("-c"), const_cast<char*>(HelperLoop),
+            const_cast<char*>("getDeviceDetails"), const_cast<char*>(_script.c_str()), nullptr };
+
+        const int error = posix_spawn(&_pid, "/bin/sh", &actions, &attributes, arguments, environ);
+
+        posix_spawnattr_destroy(&attributes);
+        posix_spawn_file_actions_destroy(&actions);
+        close(channels[1]);
+
+        if (error != 0) {
+            TRACE(Trace::Error, (_T("Could not spawn the device details helper: %d"), error));
+            close(channels[0]);
+            _pid = -1;
+            return false;
+        }
+
+        _channel = channels[0];
+        _buffer.clear();
+
+        TRACE(Trace::Information, (_T("Device details helper started, pid %d"), _pid));
+
+        return true;
+    }
+
+    void DeviceDetailsCoprocess::Kill()
+    {
+        if (_pid > 0) {
+            kill(-_pid, SIGKILL);
+            while ((waitpid(_pid, nullptr, 0) < 0) && (errno == EINTR)) {
+            }
+            _pid = -1;
+        }
+        if (_channel >= 0) {
+            close(_channel);
+            _channel = -1;
+        }
+        _buffer.clear();
+    }
+
+} // namespace Plugin
+} // namespace WPEFramework
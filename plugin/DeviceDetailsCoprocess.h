@@ -0,0 +1,73 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2026 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+#pragma once
+
+#include "Module.h"
+
+#include <sys/types.h>
+
+namespace WPEFramework {
+namespace Plugin {
+
+    // One long-lived /bin/sh that runs "<script> read <field>" for every
+    // request written to its stdin and frames each answer with a record
+    // separator and the exit code. The helper is spawned on first use and
+    // killed when a request times out or the stream breaks; it is restarted
+    // on the next request, at most maxRestarts times per restart window,
+    // after which requests report ERROR_UNAVAILABLE until the window passes.
+    class DeviceDetailsCoprocess {
+    public:
+        DeviceDetailsCoprocess(const DeviceDetailsCoprocess&) = delete;
+        DeviceDetailsCoprocess& operator=(const DeviceDetailsCoprocess&) = delete;
+
+        DeviceDetailsCoprocess();
+        ~DeviceDetailsCoprocess();
+
+    public:
+        // timeout and restartWindow are in ms; a running helper keeps the
+        // script it was started with until Stop().
+        void Configure(const string& script, const uint32_t timeout, const uint8_t maxRestarts, const uint32_t restartWindow);
+
+        // ERROR_NONE and the script output without its trailing newline,
+        // ERROR_GENERAL when the script exits non-zero, ERROR_TIMEDOUT, or
+        // ERROR_UNAVAILABLE when no helper can be run.
+        uint32_t Read(const string& field, string& value);
+
+        void Stop();
+
+    private:
+        bool Spawn();
+        void Kill();
+
+    private:
+        string _script;
+        Core::CriticalSection _adminLock;
+        uint32_t _timeout;
+        uint8_t _maxRestarts;
+        uint64_t _restartWindow;
+        uint8_t _restarts;
+        uint64_t _windowStart;
+        pid_t _pid;
+        int _channel;
+        string _buffer;
+    };
+
+} // namespace Plugin
+} // namespace WPEFramework
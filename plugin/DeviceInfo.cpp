@@ -48,7 +48,7 @@ namespace WPEFramework
          **/
         SERVICE_REGISTRATION(DeviceInfo, API_VERSION_NUMBER_MAJOR, API_VERSION_NUMBER_MINOR, API_VERSION_NUMBER_PATCH);
 
-    DeviceInfo::DeviceInfo() : _service(nullptr), _connectionId(0), _deviceInfo(nullptr), _deviceAudioCapabilities(nullptr), _deviceVideoCapabilities(nullptr), configure(nullptr)
+    DeviceInfo::DeviceInfo() : _service(nullptr), _connectionId(0), _deviceInfo(nullptr), _deviceAudioCapabilities(nullptr), _deviceVideoCapabilities(nullptr), configure(nullptr), _notification(*this)
     {
         SYSLOG(Logging::Startup, (_T("DeviceInfo Constructor")));
     }
@@ -94,10 +94,26 @@ namespace WPEFramework
             {
                 message = _T("DeviceInfo implementation did not provide a configuration interface");
             }
+            _deviceInfoExtended = _deviceInfo->QueryInterface<Exchange::IDeviceInfoExtended>();
+            ASSERT(_deviceInfoExtended != nullptr);
+
             // Invoking Plugin API register to wpeframework
             Exchange::JDeviceInfo::Register(*this, _deviceInfo);
             Exchange::JDeviceAudioCapabilities::Register(*this, _deviceAudioCapabilities);
             Exchange::JDeviceVideoCapabilities::Register(*this, _deviceVideoCapabilities);
+            Register<JsonObject, JsonObject>(_T("refreshidentity"), &DeviceInfo::RefreshIdentity, this);
+            Register<JsonObject, JsonObject>(_T("sourcestatistics"), &DeviceInfo::SourceStatistics, this);
+            Register<JsonObject, JsonObject>(_T("networkidentity"), &DeviceInfo::NetworkIdentity, this);
+            Register<JsonObject, JsonObject>(_T("networkaddresses"), &DeviceInfo::NetworkAddresses, this);
+            Register<JsonObject, JsonObject>(_T("systeminfohistory"), &DeviceInfo::SystemInfoHistory, this);
+            Register<JsonObject, JsonObject>(_T("systeminfofields"), &DeviceInfo::SystemInfoFields, this);
+            Register<JsonObject, JsonObject>(_T("memorypressure"), &DeviceInfo::MemoryPressure, this);
+            Register<JsonObject, JsonObject>(_T("thermalinfo"), &DeviceInfo::ThermalInfo, this);
+            Register<JsonObject, JsonObject>(_T("audiocapabilitymatrix"), &DeviceInfo::AudioCapabilityMatrix, this);
+
+            if (_deviceInfoExtended != nullptr) {
+                _deviceInfoExtended->Register(&_notification);
+            }
         }
         else
         {
@@ -128,8 +144,22 @@ namespace WPEFramework
             _deviceVideoCapabilities->Release();
             _deviceVideoCapabilities = nullptr;
 
+            Unregister(_T("audiocapabilitymatrix"));
+            Unregister(_T("thermalinfo"));
+            Unregister(_T("memorypressure"));
+            Unregister(_T("systeminfofields"));
+            Unregister(_T("systeminfohistory"));
+            Unregister(_T("networkaddresses"));
+            Unregister(_T("networkidentity"));
+            Unregister(_T("sourcestatistics"));
+            Unregister(_T("refreshidentity"));
             Exchange::JDeviceInfo::Unregister(*this);
 
+            if (_deviceInfoExtended != nullptr) {
+                _deviceInfoExtended->Unregister(&_notification);
+                _deviceInfoExtended->Release();
+                _deviceInfoExtended = nullptr;
+            }
             configure->Release();
 
             // Stop processing:
@@ -178,6 +208,291 @@ namespace WPEFramework
         return "The DeviceInfo plugin allows retrieving of various device-related information.";
     }
 
+    void DeviceInfo::EstbIpChanged(const string& ip)
+    {
+        JsonObject params;
+        params[_T("estb_ip")] = ip;
+        Notify(_T("onEstbIpChanged"), params);
+    }
+
+    void DeviceInfo::ThermalThreshold(const string& zone, const int32_t temperature, const bool above)
+    {
+        JsonObject params;
+        params[_T("zone")] = zone;
+        params[_T("temperature")] = temperature;
+        params[_T("above")] = above;
+        Notify(_T("onThermalThreshold"), params);
+    }
+
+    void DeviceInfo::PressureStall(const string& resource, const string& pressure)
+    {
+        JsonObject params;
+        params[_T("resource")] = resource;
+        if (pressure.empty() == false) {
+            JsonObject figures;
+            figures.FromString(pressure);
+            params[_T("pressure")] = figures;
+        }
+        Notify(_T("onPressureStall"), params);
+    }
+
+    // Forgets every backend miss the implementation remembers, e.g. an MFR type
+    // rejected as invalid, and rebuilds the identity snapshot when it is
+    // enabled; for use after the device was re-provisioned.
+    uint32_t DeviceInfo::RefreshIdentity(const JsonObject&, JsonObject&)
+    {
+        return ((_deviceInfoExtended != nullptr) ? _deviceInfoExtended->RefreshIdentity() : Core::ERROR_UNAVAILABLE);
+    }
+
+    // Hits, misses, skipped reads and accumulated read time (us) of every MFR,
+    // RFC and file source behind the identity getters.
+    uint32_t DeviceInfo::SourceStatistics(const JsonObject&, JsonObject& response)
+    {
+        uint32_t result = Core::ERROR_UNAVAILABLE;
+
+        if (_deviceInfoExtended != nullptr) {
+            string statistics;
+            result = _deviceInfoExtended->SourceStatistics(statistics);
+            if (result == Core::ERROR_NONE) {
+                response.FromString(statistics);
+            }
+        }
+
+        return (result);
+    }
+
+    // eth_mac, estb_mac, wifi_mac and estb_ip in one response, resolved by the
+    // implementation with one getDeviceDetails.sh run covering all four. A
+    // field that can not be resolved is left out; the call only fails when
+    // none of them could be.
+    uint32_t DeviceInfo::NetworkIdentity(const JsonObject&, JsonObject& response)
+    {
+        uint32_t result = Core::ERROR_UNAVAILABLE;
+
+        if (_deviceInfoExtended != nullptr) {
+            string ethMac;
+            string estbMac;
+            string wifiMac;
+            string estbIp;
+
+            result = _deviceInfoExtended->NetworkIdentity(ethMac, estbMac, wifiMac, estbIp);
+            if (result == Core::ERROR_NONE) {
+                if (ethMac.empty() == false) {
+                    response[_T("eth_mac")] = ethMac;
+                }
+                if (estbMac.empty() == false) {
+                    response[_T("estb_mac")] = estbMac;
+                }
+                if (wifiMac.empty() == false) {
+                    response[_T("wifi_mac")] = wifiMac;
+                }
+                if (estbIp.empty() == false) {
+                    response[_T("estb_ip")] = estbIp;
+                }
+            }
+        }
+
+        return (result);
+    }
+
+    // Every interface with all of its IPv4 and IPv6 addresses, prefix lengths
+    // and scopes, from the implementation's interface model. Addresses() can
+    // only carry a single ip per interface. Optional parameters select what is
+    // returned, before anything is marshalled: "interfaces" (name glob), "up",
+    // "hasaddress" and "family" ("ipv4" or "ipv6").
+    uint32_t DeviceInfo::NetworkAddresses(const JsonObject& parameters, JsonObject& response)
+    {
+        uint32_t result = Core::ERROR_UNAVAILABLE;
+
+        if (_deviceInfoExtended != nullptr) {
+            const string interfaces = (parameters.HasLabel(_T("interfaces")) == true) ? parameters[_T("interfaces")].String() : string();
+            const bool up = (parameters.HasLabel(_T("up")) == true) && (parameters[_T("up")].Boolean() == true);
+            const bool hasAddress = (parameters.HasLabel(_T("hasaddress")) == true) && (parameters[_T("hasaddress")].Boolean() == true);
+            const string family = (parameters.HasLabel(_T("family")) == true) ? parameters[_T("family")].String() : string();
+            string addresses;
+
+            result = _deviceInfoExtended->NetworkAddresses(interfaces, up, hasAddress, family, addresses);
+            if (result == Core::ERROR_NONE) {
+                response.FromString(addresses);
+            }
+        }
+
+        return (result);
+    }
+
+    // The load and memory samples of the last "window" seconds (all that are
+    // kept when omitted), oldest first, in one call. They come from the ring
+    // the implementation's SystemInfo() sampler fills, so no /proc read
+    // happens here.
+    uint32_t DeviceInfo::SystemInfoHistory(const JsonObject& parameters, JsonObject& response)
+    {
+        uint32_t result = Core::ERROR_UNAVAILABLE;
+
+        if (_deviceInfoExtended != nullptr) {
+            const uint32_t window = (parameters.HasLabel(_T("window")) == true)
+                ? static_cast<uint32_t>(parameters[_T("window")].Number())
+                : ~static_cast<uint32_t>(0);
+            string samples;
+
+            result = _deviceInfoExtended->SystemInfoHistory(window, samples);
+            if (result == Core::ERROR_NONE) {
+                response.FromString(samples);
+            }
+        }
+
+        return (result);
+    }
+
+    // The systeminfo members named in "fields" and nothing else; all of them
+    // when it is omitted. They come from the implementation's latest sample,
+    // and a probe for cpuload and freeram does not pay for the MFR serial
+    // number lookup or the version query. Besides the systeminfo members,
+    // "availableram", "cachedram" and "cmafree" report MemAvailable, Cached and
+    // CmaFree from /proc/meminfo. "fields" must be an array of member names.
+    uint32_t DeviceInfo::SystemInfoFields(const JsonObject& parameters, JsonObject& response)
+    {
+        uint32_t result = Core::ERROR_UNAVAILABLE;
+
+        if (_deviceInfoExtended != nullptr) {
+            string fields;
+            if (parameters.HasLabel(_T("fields")) == true) {
+                // Anything but an array would otherwise read as "all of them".
+                if (parameters[_T("fields")].Content() != JsonValue::type::ARRAY) {
+                    return (Core::ERROR_BAD_REQUEST);
+                }
+                const JsonArray names = parameters[_T("fields")].Array();
+                names.ToString(fields);
+            }
+
+            string info;
+            result = _deviceInfoExtended->SystemInfoFields(fields, info);
+            if (result == Core::ERROR_NONE) {
+                response.FromString(info);
+            }
+        }
+
+        return (result);
+    }
+
+    // Every audio port with its capabilities, MS12 capabilities and MS12
+    // profiles in one response, instead of supportedaudioports followed by
+    // three calls per port. The ports come from one SupportedAudioPorts()
+    // enumeration; the per port answers are served from the capability cache
+    // DeviceAudioCapabilities keeps until DS reports a change. The masks have
+    // bit n set for the capability enum value n. A port DS could not answer
+    // every query for has "success":false and lacks the fields that failed.
+    uint32_t DeviceInfo::AudioCapabilityMatrix(const JsonObject&, JsonObject& response)
+    {
+        RPC::IStringIterator* supportedAudioPorts = nullptr;
+        bool success = false;
+
+        const uint32_t result = _deviceInfo->SupportedAudioPorts(supportedAudioPorts, success);
+
+        if ((result == Core::ERROR_NONE) && (supportedAudioPorts != nullptr)) {
+            JsonArray ports;
+            string name;
+
+            while (supportedAudioPorts->Next(name) == true) {
+                JsonObject port;
+                bool answered = true;
+                port[_T("name")] = name;
+
+                Exchange::IDeviceAudioCapabilities::IAudioCapabilityIterator* audioCapabilities = nullptr;
+                if ((_deviceAudioCapabilities->AudioCapabilities(name, audioCapabilities, success) == Core::ERROR_NONE) && (audioCapabilities != nullptr)) {
+                    Exchange::IDeviceAudioCapabilities::AudioCapability capability;
+                    JsonArray names;
+                    uint32_t mask = 0;
+                    while (audioCapabilities->Next(capability) == true) {
+                        names.Add(JsonValue(Core::EnumerateType<Exchange::IDeviceAudioCapabilities::AudioCapability>(capability).Data()));
+                        if (capability != Exchange::IDeviceAudioCapabilities::AUDIOCAPABILITY_NONE) {
+                            mask |= (1u << capability);
+                        }
+                    }
+                    audioCapabilities->Release();
+                    port[_T("audiocapabilities")] = names;
+                    port[_T("audiomask")] = mask;
+                } else {
+                    answered = false;
+                }
+
+                Exchange::IDeviceAudioCapabilities::IMS12CapabilityIterator* ms12Capabilities = nullptr;
+                if ((_deviceAudioCapabilities->MS12Capabilities(name, ms12Capabilities, success) == Core::ERROR_NONE) && (ms12Capabilities != nullptr)) {
+                    Exchange::IDeviceAudioCapabilities::MS12Capability capability;
+                    JsonArray names;
+                    uint32_t mask = 0;
+                    while (ms12Capabilities->Next(capability) == true) {
+                        names.Add(JsonValue(Core::EnumerateType<Exchange::IDeviceAudioCapabilities::MS12Capability>(capability).Data()));
+                        if (capability != Exchange::IDeviceAudioCapabilities::MS12CAPABILITY_NONE) {
+                            mask |= (1u << capability);
+                        }
+                    }
+                    ms12Capabilities->Release();
+                    port[_T("ms12capabilities")] = names;
+                    port[_T("ms12mask")] = mask;
+                } else {
+                    answered = false;
+                }
+
+                RPC::IStringIterator* profiles = nullptr;
+                if ((_deviceAudioCapabilities->SupportedMS12AudioProfiles(name, profiles, success) == Core::ERROR_NONE) && (profiles != nullptr)) {
+                    JsonArray names;
+                    string profile;
+                    while (profiles->Next(profile) == true) {
+                        names.Add(JsonValue(profile));
+                    }
+                    profiles->Release();
+                    port[_T("ms12profiles")] = names;
+                } else {
+                    answered = false;
+                }
+
+                port[_T("success")] = answered;
+                ports.Add(port);
+            }
+
+            supportedAudioPorts->Release();
+            response[_T("ports")] = ports;
+        }
+
+        return (result);
+    }
+
+    // PSI averages for memory, cpu and io (a resource the kernel does not
+    // report is left out) and the Rss/Pss of the Thunder host and, when it
+    // runs in a process of its own, of the DeviceInfo implementation.
+    uint32_t DeviceInfo::MemoryPressure(const JsonObject&, JsonObject& response)
+    {
+        uint32_t result = Core::ERROR_UNAVAILABLE;
+
+        if (_deviceInfoExtended != nullptr) {
+            string pressure;
+            result = _deviceInfoExtended->MemoryPressure(static_cast<uint32_t>(getpid()), pressure);
+            if (result == Core::ERROR_NONE) {
+                response.FromString(pressure);
+            }
+        }
+
+        return (result);
+    }
+
+    // Thermal zone temperatures, cooling device states and current and
+    // maximum cpufreq per core. While the implementation's sampler runs this
+    // is its latest sample and costs no sysfs read.
+    uint32_t DeviceInfo::ThermalInfo(const JsonObject&, JsonObject& response)
+    {
+        uint32_t result = Core::ERROR_UNAVAILABLE;
+
+        if (_deviceInfoExtended != nullptr) {
+            string info;
+            result = _deviceInfoExtended->ThermalInfo(info);
+            if (result == Core::ERROR_NONE) {
+                response.FromString(info);
+            }
+        }
+
+        return (result);
+    }
+
     void DeviceInfo::Deactivated(RPC::IRemoteConnection* connection)
     {
         if (connection->Id() == _connectionId) {
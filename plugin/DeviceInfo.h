@@ -20,6 +20,7 @@
 #pragma once
 
 #include "Module.h"
+#include "IDeviceInfoExtended.h"
 #include <interfaces/IDeviceInfo.h>
 #include <interfaces/json/JDeviceInfo.h>
 #include <interfaces/json/JsonData_DeviceInfo.h>
@@ -37,6 +38,41 @@ namespace WPEFramework
     {
         class DeviceInfo : public PluginHost::IPlugin, public PluginHost::JSONRPC 
         {
+            private:
+                class Notification : public Exchange::IDeviceInfoExtended::INotification {
+                public:
+                    Notification(const Notification&) = delete;
+                    Notification& operator=(const Notification&) = delete;
+
+                    explicit Notification(DeviceInfo& parent)
+                        : _parent(parent)
+                    {
+                    }
+                    ~Notification() override = default;
+
+                    BEGIN_INTERFACE_MAP(Notification)
+                    INTERFACE_ENTRY(Exchange::IDeviceInfoExtended::INotification)
+                    END_INTERFACE_MAP
+
+                    void EstbIpChanged(const string& ip) override
+                    {
+                        _parent.EstbIpChanged(ip);
+                    }
+
+                    void ThermalThreshold(const string& zone, const int32_t temperature, const bool above) override
+                    {
+                        _parent.ThermalThreshold(zone, temperature, above);
+                    }
+
+                    void PressureStall(const string& resource, const string& pressure) override
+                    {
+                        _parent.PressureStall(resource, pressure);
+                    }
+
+                private:
+                    DeviceInfo& _parent;
+                };
+
             public:
                 DeviceInfo(const DeviceInfo&) = delete;
                 DeviceInfo& operator=(const DeviceInfo&) = delete;
@@ -60,6 +96,18 @@ namespace WPEFramework
 
             private:
                 void Deactivated(RPC::IRemoteConnection* connection);
+                void EstbIpChanged(const string& ip);
+                void ThermalThreshold(const string& zone, const int32_t temperature, const bool above);
+                void PressureStall(const string& resource, const string& pressure);
+                uint32_t RefreshIdentity(const JsonObject& parameters, JsonObject& response);
+                uint32_t SourceStatistics(const JsonObject& parameters, JsonObject& response);
+                uint32_t NetworkIdentity(const JsonObject& parameters, JsonObject& response);
+                uint32_t NetworkAddresses(const JsonObject& parameters, JsonObject& response);
+                uint32_t SystemInfoHistory(const JsonObject& parameters, JsonObject& response);
+                uint32_t SystemInfoFields(const JsonObject& parameters, JsonObject& response);
+                uint32_t MemoryPressure(const JsonObject& parameters, JsonObject& response);
+                uint32_t ThermalInfo(const JsonObject& parameters, JsonObject& response);
+                uint32_t AudioCapabilityMatrix(const JsonObject& parameters, JsonObject& response);
 
             private:
                 PluginHost::IShell* _service{};
@@ -68,6 +116,9 @@ namespace WPEFramework
                 Exchange::IDeviceAudioCapabilities* _deviceAudioCapabilities{};
                 Exchange::IDeviceVideoCapabilities* _deviceVideoCapabilities{};
                 Exchange::IConfiguration* configure;
+                Exchange::IDeviceInfoExtended* _deviceInfoExtended{};
+                // Pushes "onEstbIpChanged", "onThermalThreshold" and "onPressureStall" for the implementation.
+                Core::Sink<Notification> _notification;
        };
     } // namespace Plugin
 } // namespace WPEFramework
@@ -18,52 +18,111 @@
 **/
 
 #include "DeviceInfoImplementation.h"
+#include "FileKey.h"
 
 #include "mfrMgr.h"
 #include "rfcapi.h"
-#include "secure_wrapper.h"
 #include "exception.hpp"
 #include "host.hpp"
 #include "manager.hpp"
 #include "UtilsIarm.h"
 
-#include <fstream>
-#include <regex>
+#include <algorithm>
+#include <linux/rtnetlink.h>
+#include <net/if.h>
+#include <sys/socket.h>
+#include <unistd.h>
 
 namespace WPEFramework {
 namespace Plugin {
     namespace {
 
-        uint32_t GetFileRegex(const char* filename, const std::regex& regex, string& response)
+        // Every file-backed value DeviceInfo reports, resolved without std::regex.
+        namespace FileKeys {
+            constexpr FileKey ModelNumber(_T("/etc/device.properties"), _T("MODEL_NUM"), FileKey::ASSIGNMENT);
+            constexpr FileKey ManufacturerName(_T("/etc/device.properties"), _T("MFG_NAME"), FileKey::ASSIGNMENT);
+            constexpr FileKey DeviceName(_T("/etc/device.properties"), _T("DEVICE_NAME"), FileKey::ASSIGNMENT);
+            constexpr FileKey FriendlyId(_T("/etc/device.properties"), _T("FRIENDLY_ID"), FileKey::ASSIGNMENT);
+            constexpr FileKey DevicePropertiesType(_T("/etc/device.properties"), _T("DEVICE_TYPE"), FileKey::ASSIGNMENT);
+            constexpr FileKey SocName(_T("/etc/device.properties"), _T("SOC"), FileKey::ASSIGNMENT);
+            constexpr FileKey ChipsetName(_T("/etc/device.properties"), _T("CHIPSET_NAME"), FileKey::ASSIGNMENT);
+            constexpr FileKey AuthServiceDeviceType(_T("/etc/authService.conf"), _T("deviceType"), FileKey::ASSIGNMENT);
+            constexpr FileKey PartnerId(_T("/opt/www/authService/partnerId3.dat"), _T(""), FileKey::LINE);
+            constexpr FileKey Manufacturer(_T("/tmp/.manufacturer"), _T(""), FileKey::LINE);
+            constexpr FileKey ImageName(_T("/version.txt"), _T("imagename:"), FileKey::PREFIXED);
+            constexpr FileKey SdkVersion(_T("/version.txt"), _T("SDK_VERSION="), FileKey::PREFIXED);
+            constexpr FileKey MediaRite(_T("/version.txt"), _T("MEDIARITE="), FileKey::PREFIXED);
+            constexpr FileKey YoctoVersion(_T("/version.txt"), _T("YOCTO_VERSION="), FileKey::PREFIXED);
+        }
+
+        uint32_t GetFileKey(const FileCache& files, const FileKey& key, string& response)
         {
-            uint32_t result = Core::ERROR_GENERAL;
+            string content;
+            return (files.Content(key.file, content) == Core::ERROR_NONE) ? key.Find(content, response) : Core::ERROR_GENERAL;
+        }
 
-            std::ifstream file(filename);
-            if (file) {
-                string line;
-                while (std::getline(file, line)) {
-                    std::smatch sm;
-                    if (std::regex_match(line, sm, regex)) {
-                        ASSERT(sm.size() == 2);
-                        response = sm[1];
-                        result = Core::ERROR_NONE;
-                        break;
+        inline bool IsDigit(const char c)
+        {
+            return (c >= '0') && (c <= '9');
+        }
+
+        // Leftmost (\d+)\.(\d+)[sp] in the image name, e.g. 22 and 03 in "CUSTOM_VBN_22.03s_sprint".
+        bool ReleaseNumbers(const string& imageName, string& major, string& minor)
+        {
+            const size_t length = imageName.length();
+            size_t index = 0;
+
+            while (index < length) {
+                if (IsDigit(imageName[index]) == false) {
+                    index++;
+                    continue;
+                }
+
+                const size_t majorBegin = index;
+                while ((index < length) && IsDigit(imageName[index])) {
+                    index++;
+                }
+
+                if ((index < length) && (imageName[index] == '.')) {
+                    const size_t minorBegin = index + 1;
+                    size_t minorEnd = minorBegin;
+                    while ((minorEnd < length) && IsDigit(imageName[minorEnd])) {
+                        minorEnd++;
+                    }
+
+                    if ((minorEnd > minorBegin) && (minorEnd < length) && ((imageName[minorEnd] == 's') || (imageName[minorEnd] == 'p'))) {
+                        major.assign(imageName, majorBegin, index - majorBegin);
+                        minor.assign(imageName, minorBegin, minorEnd - minorBegin);
+                        return true;
                     }
                 }
             }
 
-            return result;
+            return false;
         }
 
-        uint32_t GetMFRData(mfrSerializedType_t type, string& response)
+        // Reads an MFR serialized type. A non-zero timeout (ms) bounds the IPC
+        // call; the breaker fails the call fast while the MFR daemon is not
+        // answering, which callers see as a transient failure.
+        uint32_t GetMFRData(mfrSerializedType_t type, string& response, IARM_Result_t& status, CircuitBreaker& breaker, const uint32_t timeout)
         {
             uint32_t result = Core::ERROR_GENERAL;
 
+            if (breaker.Allow() == false) {
+                status = IARM_RESULT_IPCCORE_FAIL;
+                TRACE_GLOBAL(Trace::Information, (_T("MFR circuit open, skipping %d"), type));
+                return result;
+            }
+
             IARM_Bus_MFRLib_GetSerializedData_Param_t param;
             param.bufLen = 0;
             param.type = type;
-            auto status = IARM_Bus_Call(
-                IARM_BUS_MFRLIB_NAME, IARM_BUS_MFRLIB_API_GetSerializedData, &param, sizeof(param));
+            const uint64_t start = Core::Time::Now().Ticks();
+            status = (timeout > 0)
+                ? IARM_Bus_Call_with_IPCTimeout(IARM_BUS_MFRLIB_NAME, IARM_BUS_MFRLIB_API_GetSerializedData, &param, sizeof(param), static_cast<int>(timeout))
+                : IARM_Bus_Call(IARM_BUS_MFRLIB_NAME, IARM_BUS_MFRLIB_API_GetSerializedData, &param, sizeof(param));
+            const bool late = (timeout > 0) && ((Core::Time::Now().Ticks() - start) > (static_cast<uint64_t>(timeout) * Core::Time::TicksPerMillisecond));
+
             if ((status == IARM_RESULT_SUCCESS) && param.bufLen) {
                 response.assign(param.buffer, param.bufLen);
                 result = Core::ERROR_NONE;
@@ -71,15 +130,22 @@ namespace Plugin {
                 TRACE_GLOBAL(Trace::Information, (_T("MFR error [%d] for %d"), status, type));
             }
 
+            // An answer, even "unknown type", shows the daemon is alive.
+            if ((late == false) && ((status == IARM_RESULT_SUCCESS) || (status == IARM_RESULT_INVALID_PARAM))) {
+                breaker.Success();
+            } else {
+                breaker.Failure();
+            }
+
             return result;
         }
 
-        uint32_t GetRFCData(const char* name, string& response)
+        uint32_t GetRFCData(const char* name, string& response, WDMP_STATUS& status)
         {
             uint32_t result = Core::ERROR_GENERAL;
 
             RFC_ParamData_t param;
-            auto status = getRFCParameter(nullptr, name, &param);
+            status = getRFCParameter(nullptr, name, &param);
             if ((status == WDMP_SUCCESS) && param.value[0]) {
                 response = param.value;
                 result = Core::ERROR_NONE;
@@ -89,13 +155,390 @@ namespace Plugin {
 
             return result;
         }
-        
+
+        constexpr TCHAR DeviceDetailsScript[] = _T("/lib/rdk/getDeviceDetails.sh");
+
+        // Members SystemInfoFields() can be asked for.
+        enum systeminfofield : uint16_t {
+            FIELD_VERSION = 0x0001,
+            FIELD_UPTIME = 0x0002,
+            FIELD_TOTALRAM = 0x0004,
+            FIELD_FREERAM = 0x0008,
+            FIELD_TOTALSWAP = 0x0010,
+            FIELD_FREESWAP = 0x0020,
+            FIELD_DEVICENAME = 0x0040,
+            FIELD_CPULOAD = 0x0080,
+            FIELD_CPULOADAVG = 0x0100,
+            FIELD_SERIALNUMBER = 0x0200,
+            FIELD_TIME = 0x0400,
+            FIELD_AVAILABLERAM = 0x0800,
+            FIELD_CACHEDRAM = 0x1000,
+            FIELD_CMAFREE = 0x2000
+        };
+
+        const struct {
+            const TCHAR* name;
+            systeminfofield field;
+        } SystemInfoFieldNames[] = {
+            { _T("version"), FIELD_VERSION },
+            { _T("uptime"), FIELD_UPTIME },
+            { _T("totalram"), FIELD_TOTALRAM },
+            { _T("freeram"), FIELD_FREERAM },
+            { _T("totalswap"), FIELD_TOTALSWAP },
+            { _T("freeswap"), FIELD_FREESWAP },
+            { _T("devicename"), FIELD_DEVICENAME },
+            { _T("cpuload"), FIELD_CPULOAD },
+            { _T("cpuloadavg"), FIELD_CPULOADAVG },
+            { _T("serialnumber"), FIELD_SERIALNUMBER },
+            { _T("time"), FIELD_TIME },
+            { _T("availableram"), FIELD_AVAILABLERAM },
+            { _T("cachedram"), FIELD_CACHEDRAM },
+            { _T("cmafree"), FIELD_CMAFREE }
+        };
+
+        // The SystemInfo() time stamp.
+        string CurrentTime()
+        {
+            struct timespec currentTime{};
+            clock_gettime(CLOCK_REALTIME, &currentTime);
+            return (Core::Time(currentTime).ToRFC1123(true));
+        }
+
+        JsonObject StallObject(const PressureMonitor::Stall& stall)
+        {
+            JsonObject object;
+            object[_T("avg10")] = stall.avg10;
+            object[_T("avg60")] = stall.avg60;
+            object[_T("avg300")] = stall.avg300;
+            object[_T("total")] = stall.total;
+            return (object);
+        }
+
+        JsonObject PressureObject(const PressureMonitor::Pressure& pressure)
+        {
+            JsonObject object;
+            object[_T("some")] = StallObject(pressure.some);
+            object[_T("full")] = StallObject(pressure.full);
+            return (object);
+        }
+
+        bool ProcessObject(const pid_t pid, JsonObject& object)
+        {
+            uint64_t rss = 0;
+            uint64_t pss = 0;
+
+            const bool result = (ProcfsReader::Rollup(pid, rss, pss) == Core::ERROR_NONE);
+            if (result == true) {
+                object[_T("pid")] = static_cast<uint32_t>(pid);
+                object[_T("rss")] = rss;
+                object[_T("pss")] = pss;
+            }
+            return (result);
+        }
+
+        // "getDeviceDetails.sh read" without a field prints every detail as a field=value line.
+        namespace NetworkKeys {
+            constexpr FileKey EthMac(DeviceDetailsScript, _T("eth_mac"), FileKey::ASSIGNMENT);
+            constexpr FileKey EstbMac(DeviceDetailsScript, _T("estb_mac"), FileKey::ASSIGNMENT);
+            constexpr FileKey WifiMac(DeviceDetailsScript, _T("wifi_mac"), FileKey::ASSIGNMENT);
+            constexpr FileKey EstbIp(DeviceDetailsScript, _T("estb_ip"), FileKey::ASSIGNMENT);
+        }
+
+        // One entry per interface the filter keeps. The ip is the last IPv4
+        // address, as the adapter walk always reported it, or the first global
+        // IPv6 one when there is none (or the filter only admits IPv6); it stays
+        // empty for an interface with link-local addresses only.
+        void AddressesFromLinks(const std::list<NetlinkMonitor::Link>& links, const AddressFilter& filter, std::list<Exchange::IDeviceInfo::AddressesInfo>& addresses)
+        {
+            Exchange::IDeviceInfo::AddressesInfo entry;
+
+            for (const NetlinkMonitor::Link& link : links) {
+                if (filter.Keeps(link) == false) {
+                    continue;
+                }
+
+                const NetlinkMonitor::Address* ipv6 = nullptr;
+
+                entry.name = link.name;
+                entry.mac = link.mac;
+                entry.ip.clear();
+
+                for (const NetlinkMonitor::Address& address : link.addresses) {
+                    if (filter.Matches(address) == false) {
+                        continue;
+                    }
+                    if (address.family == AF_INET) {
+                        entry.ip = address.address;
+                    } else if ((ipv6 == nullptr) && (address.family == AF_INET6) && (address.scope == RT_SCOPE_UNIVERSE)) {
+                        ipv6 = &address;
+                    }
+                }
+
+                if ((entry.ip.empty() == true) && (ipv6 != nullptr)) {
+                    entry.ip = ipv6->address;
+                }
+
+                addresses.push_back(entry);
+            }
+        }
+
+        const TCHAR* ScopeName(const uint8_t scope)
+        {
+            switch (scope) {
+            case RT_SCOPE_UNIVERSE:
+                return (_T("global"));
+            case RT_SCOPE_SITE:
+                return (_T("site"));
+            case RT_SCOPE_LINK:
+                return (_T("link"));
+            case RT_SCOPE_HOST:
+                return (_T("host"));
+            default:
+                return (_T("nowhere"));
+            }
+        }
+
+        class MFRSource : public ValueSource {
+        public:
+            MFRSource(const mfrSerializedType_t type, const TCHAR name[], CircuitBreaker& breaker, const std::atomic<uint32_t>& timeout)
+                : ValueSource(string(_T("MFR ")) + name)
+                , _type(type)
+                , _breaker(breaker)
+                , _timeout(timeout)
+            {
+            }
+
+        protected:
+            // The MFR library rejects types the platform does not provide with
+            // INVALID_PARAM; that answer does not change while the device runs.
+            // A successful call with an empty buffer is an EMPTY answer.
+            outcome Read(string& value) const override
+            {
+                IARM_Result_t status;
+                return (GetMFRData(_type, value, status, _breaker, _timeout) == Core::ERROR_NONE) ? FOUND
+                    : (status == IARM_RESULT_SUCCESS) ? EMPTY
+                    : (status == IARM_RESULT_INVALID_PARAM) ? ABSENT : MISSING;
+            }
+
+        private:
+            const mfrSerializedType_t _type;
+            CircuitBreaker& _breaker;
+            const std::atomic<uint32_t>& _timeout;
+        };
+
+        class RFCSource : public ValueSource {
+        public:
+            explicit RFCSource(const TCHAR name[])
+                : ValueSource(string(_T("RFC ")) + name)
+                , _name(name)
+            {
+            }
+
+        protected:
+            outcome Read(string& value) const override
+            {
+                WDMP_STATUS status;
+                return (GetRFCData(_name, value, status) == Core::ERROR_NONE) ? FOUND
+                    : (status == WDMP_SUCCESS) ? EMPTY : MISSING;
+            }
+
+        private:
+            const TCHAR* _name;
+        };
+
+        // A key of /etc/device.properties, served by the indexed store.
+        class PropertySource : public ValueSource {
+        public:
+            PropertySource(const FileCache& files, const DevicePropertiesStore& properties, const FileKey& key)
+                : ValueSource(string(key.file) + _T(" ") + key.key)
+                , _files(files)
+                , _properties(properties)
+                , _key(key)
+            {
+            }
+
+        protected:
+            outcome Read(string& value) const override
+            {
+                return (_properties.Get(_key.key, value) == Core::ERROR_NONE) ? FOUND : ABSENT;
+            }
+            uint32_t Generation() const override
+            {
+                return (_files.Generation(_key.file));
+            }
+
+        private:
+            const FileCache& _files;
+            const DevicePropertiesStore& _properties;
+            const FileKey& _key;
+        };
+
+        class FileSource : public ValueSource {
+        public:
+            FileSource(const FileCache& files, const FileKey& key)
+                : ValueSource(string(key.file) + ((key.length > 0) ? (string(_T(" ")) + key.key) : string()))
+                , _files(files)
+                , _key(key)
+            {
+            }
+
+        protected:
+            outcome Read(string& value) const override
+            {
+                return (GetFileKey(_files, _key, value) == Core::ERROR_NONE) ? FOUND : ABSENT;
+            }
+            uint32_t Generation() const override
+            {
+                return (_files.Generation(_key.file));
+            }
+
+        private:
+            const FileCache& _files;
+            const FileKey& _key;
+        };
+
+        // Every backend a chained field can be read from.
+        enum source : uint8_t {
+            MFR_SERIALNUMBER,
+            MFR_MODELNAME,
+            MFR_MANUFACTURER,
+            MFR_PROVISIONED_MODELNAME,
+            MFR_PDRIVERSION,
+            RFC_SERIALNUMBER,
+            RFC_MODELNAME,
+            RFC_PARTNERID,
+            PROPERTY_MODEL_NUM,
+            PROPERTY_MFG_NAME,
+            FILE_PARTNERID,
+            FILE_MANUFACTURER,
+            SOURCES
+        };
+
+        // Fallback order of the fields that can come from more than one backend,
+        // indexed by DeviceInfoImplementation::chain.
+        struct ChainEntry {
+            const TCHAR* field;
+            uint8_t count;
+            source sources[3];
+        };
+
+        const ChainEntry Chains[] = {
+            { _T("SerialNumber"), 2, { MFR_SERIALNUMBER, RFC_SERIALNUMBER } },
+            { _T("Sku"), 3, { PROPERTY_MODEL_NUM, MFR_MODELNAME, RFC_MODELNAME } },
+            { _T("Make"), 2, { MFR_MANUFACTURER, PROPERTY_MFG_NAME } },
+            { _T("Brand"), 2, { FILE_MANUFACTURER, MFR_MANUFACTURER } },
+            { _T("DistributorId"), 2, { FILE_PARTNERID, RFC_PARTNERID } }
+        };
+
+        ValueSource* CreateSource(const source id, const FileCache& files, const DevicePropertiesStore& properties, CircuitBreaker& breaker, const std::atomic<uint32_t>& timeout)
+        {
+            ValueSource* result = nullptr;
+
+            switch (id) {
+            case MFR_SERIALNUMBER:
+                result = new MFRSource(mfrSERIALIZED_TYPE_SERIALNUMBER, _T("SERIALNUMBER"), breaker, timeout);
+                break;
+            case MFR_MODELNAME:
+                result = new MFRSource(mfrSERIALIZED_TYPE_MODELNAME, _T("MODELNAME"), breaker, timeout);
+                break;
+            case MFR_MANUFACTURER:
+                result = new MFRSource(mfrSERIALIZED_TYPE_MANUFACTURER, _T("MANUFACTURER"), breaker, timeout);
+                break;
+            case MFR_PROVISIONED_MODELNAME:
+                result = new MFRSource(mfrSERIALIZED_TYPE_PROVISIONED_MODELNAME, _T("PROVISIONED_MODELNAME"), breaker, timeout);
+                break;
+            case MFR_PDRIVERSION:
+                result = new MFRSource(mfrSERIALIZED_TYPE_PDRIVERSION, _T("PDRIVERSION"), breaker, timeout);
+                break;
+            case RFC_SERIALNUMBER:
+                result = new RFCSource(_T("Device.DeviceInfo.SerialNumber"));
+                break;
+            case RFC_MODELNAME:
+                result = new RFCSource(_T("Device.DeviceInfo.ModelName"));
+                break;
+            case RFC_PARTNERID:
+                result = new RFCSource(_T("Device.DeviceInfo.X_RDKCENTRAL-COM_Syndication.PartnerId"));
+                break;
+            case PROPERTY_MODEL_NUM:
+                result = new PropertySource(files, properties, FileKeys::ModelNumber);
+                break;
+            case PROPERTY_MFG_NAME:
+                result = new PropertySource(files, properties, FileKeys::ManufacturerName);
+                break;
+            case FILE_PARTNERID:
+                result = new FileSource(files, FileKeys::PartnerId);
+                break;
+            case FILE_MANUFACTURER:
+                result = new FileSource(files, FileKeys::Manufacturer);
+                break;
+            default:
+                ASSERT(false);
+                break;
+            }
+
+            return result;
+        }
     }
 
     SERVICE_REGISTRATION(DeviceInfoImplementation, 1, 0);
 
-    DeviceInfoImplementation::DeviceInfoImplementation():_service(nullptr)
+    DeviceInfoImplementation::DeviceInfoImplementation()
+        : _service(nullptr)
+        , _files()
+        , _deviceProperties(_files, _T("/etc/device.properties"))
+        , _versionFile(_files, { &FileKeys::ImageName, &FileKeys::SdkVersion, &FileKeys::MediaRite, &FileKeys::YoctoVersion })
+        , _adminLock()
+        , _identityEnabled(false)
+        , _identity(nullptr)
+        , _retired()
+        , _sources()
+        , _chains()
+        , _prefetchers()
+        , _prefetchIndex(0)
+        , _mfrBreaker(_T("MFR"))
+        , _mfrTimeout(0)
+        , _monitor()
+        , _monitorSink(*this)
+        , _network(_deviceProperties)
+        , _notificationLock()
+        , _notifications()
+        , _estbIp()
+        , _details(DETAILS_SCRIPT)
+        , _script(DeviceDetailsScript)
+        , _coprocess()
+        , _executor()
+        , _addressesLock()
+        , _addresses()
+        , _addressesGeneration(0)
+        , _addressFilter()
+        , _procfs()
+        , _cpu()
+        , _samplerCpu()
+        , _history()
+        , _thermalReader()
+        , _thermalLock()
+        , _thermal()
+        , _thermalSpare()
+        , _thermalSampled(0)
+        , _thermalThreshold()
+        , _systemInfoSource(*this)
+        , _sampler()
+        , _pressureMonitor()
+        , _pressureSink(*this)
     {
+        static_assert((sizeof(Chains) / sizeof(Chains[0])) == CHAINS, "Chains table does not match the chain enum");
+
+        for (uint8_t id = 0; id < SOURCES; id++) {
+            _sources.emplace_back(CreateSource(static_cast<source>(id), _files, _deviceProperties, _mfrBreaker, _mfrTimeout));
+        }
+        for (const ChainEntry& entry : Chains) {
+            std::vector<const ValueSource*> sources;
+            for (uint8_t index = 0; index < entry.count; index++) {
+                sources.push_back(_sources[entry.sources[index]].get());
+            }
+            _chains.emplace_back(new ResolutionChain(entry.field, sources));
+        }
+
         Utils::IARM::init();
         try {
             device::Manager::Initialize();
@@ -110,11 +553,36 @@ namespace Plugin {
     DeviceInfoImplementation::~DeviceInfoImplementation()
     {
         LOGINFO("DeviceInfoImplementation destructor");
+        _sampler.Stop();
+        _pressureMonitor.Stop();
+        WaitForPrefetch();
+        _monitor.Stop();
+
+        _notificationLock.Lock();
+        for (Exchange::IDeviceInfoExtended::INotification* notification : _notifications) {
+            notification->Release();
+        }
+        _notifications.clear();
+        _notificationLock.Unlock();
+
         if (_service != nullptr)
         {
             _service->Release();
             _service = nullptr;
         }
+
+        std::list<ValueSource::Statistics> statistics;
+        Statistics(statistics);
+        for (const ValueSource::Statistics& entry : statistics) {
+            LOGINFO("%s: %u hits, %u misses, %u skipped, %llu us", entry.name.c_str(), entry.hits, entry.misses, entry.skips,
+                static_cast<unsigned long long>(entry.latency));
+        }
+
+        delete _identity.exchange(nullptr);
+        for (const Identity* identity : _retired) {
+            delete identity;
+        }
+        _retired.clear();
     }
 
     uint32_t DeviceInfoImplementation::Configure(PluginHost::IShell* service)
@@ -124,45 +592,382 @@ namespace Plugin {
         _service = service;
         _service->AddRef();
 
+        Config config;
+        config.FromString(_service->ConfigLine());
+
+        const uint32_t negativeExpiry = config.NegativeCache.Expiry.Value();
+        for (const std::unique_ptr<ValueSource>& source : _sources) {
+            const string& name = source->Name();
+            if ((name.compare(0, 4, _T("MFR ")) == 0) || (name.compare(0, 4, _T("RFC ")) == 0)) {
+                source->NegativeExpiry(negativeExpiry);
+            }
+        }
+        auto index = config.NegativeCache.Sources.Elements();
+        while (index.Next() == true) {
+            const string name = index.Current().Name.Value();
+            bool found = false;
+            for (const std::unique_ptr<ValueSource>& source : _sources) {
+                if (source->Name() == name) {
+                    source->NegativeExpiry(index.Current().Expiry.Value());
+                    found = true;
+                    break;
+                }
+            }
+            if (found == false) {
+                LOGWARN("Negative cache entry for unknown source '%s'", name.c_str());
+            }
+        }
+
+        _mfrTimeout = config.MFR.Timeout.Value();
+        _mfrBreaker.Configure(config.MFR.FailureThreshold.Value(), config.MFR.OpenTime.Value());
+
+        _network.Configure(NetworkInterfaces::ETHERNET, config.DeviceDetails.Ethernet.Value());
+        _network.Configure(NetworkInterfaces::ESTB, config.DeviceDetails.Estb.Value());
+        _network.Configure(NetworkInterfaces::WIFI, config.DeviceDetails.Wifi.Value());
+        const string mode = config.DeviceDetails.Mode.Value();
+        if ((mode == _T("native")) || (mode == _T("netlink"))) {
+            _details = DETAILS_NATIVE;
+        } else if (mode == _T("coprocess")) {
+            _details = DETAILS_COPROCESS;
+        } else {
+            if (mode != _T("script")) {
+                LOGWARN("Unknown device details mode '%s', using the script", mode.c_str());
+            }
+            _details = DETAILS_SCRIPT;
+        }
+        _script = config.DeviceDetails.Script.Value().empty() ? string(DeviceDetailsScript) : config.DeviceDetails.Script.Value();
+        _coprocess.Stop();
+        _coprocess.Configure(_script, config.DeviceDetails.Timeout.Value(), config.DeviceDetails.Restarts.Value(), config.DeviceDetails.RestartWindow.Value());
+        _executor.Configure(config.DeviceDetails.Timeout.Value());
+        if (mode != _T("netlink")) {
+            _monitor.Stop();
+        } else if ((_monitor.Running() == false) && (_monitor.Start(&_monitorSink) != Core::ERROR_NONE)) {
+            LOGWARN("RTNETLINK is not available, reading the interfaces on demand and not reporting EstbIpChanged");
+        }
+        MonitorStarted();
+
+        AddressFilter filter;
+        filter.pattern = config.Addresses.Interfaces.Value();
+        filter.up = config.Addresses.Up.Value();
+        filter.hasAddress = config.Addresses.HasAddress.Value();
+        if (filter.Family(config.Addresses.Family.Value()) == false) {
+            LOGWARN("Unknown address family '%s', reporting all addresses", config.Addresses.Family.Value().c_str());
+        }
+        _addressesLock.Lock();
+        _addressFilter = filter;
+        _addressesGeneration = 0;
+        _addressesLock.Unlock();
+
+        WaitForPrefetch();
+        if (config.MFRPrefetch.Value() > 0) {
+            Prefetch(config.MFRPrefetch.Value());
+        }
+
+        _identityEnabled = config.IdentitySnapshot.Value();
+        if (_identityEnabled == true) {
+            // Let the snapshot pick up the prefetched MFR values instead of
+            // fetching them a second time.
+            WaitForPrefetch();
+            TakeSnapshot();
+        }
+
+        // After the snapshot, so the first sample finds the serial number there.
+        _sampler.Stop();
+        _history.Capacity(config.SystemInfo.History.Value());
+        if ((config.Thermal.ThermalClass.Value().empty() == false) || (config.Thermal.CpuDevices.Value().empty() == false)) {
+            _thermalReader.Configure(config.Thermal.ThermalClass.Value(), config.Thermal.CpuDevices.Value());
+        }
+        _thermalLock.Lock();
+        _thermal = ThermalReader::Sample();
+        _thermalSampled = 0;
+        _thermalThreshold.Configure(config.Thermal.Threshold.Value(), config.Thermal.Hysteresis.Value());
+        _thermalLock.Unlock();
+        if (config.SystemInfo.Interval.Value() > 0) {
+            _sampler.Start(&_systemInfoSource, config.SystemInfo.Interval.Value());
+        }
+
+        _pressureMonitor.Stop();
+        const string triggers[PressureMonitor::RESOURCES] = {
+            config.Pressure.Memory.Value(),
+            config.Pressure.Cpu.Value(),
+            config.Pressure.Io.Value()
+        };
+        if (_pressureMonitor.Start(triggers, &_pressureSink) != Core::ERROR_NONE) {
+            LOGWARN("PSI triggers could not be set, PressureStall will not be raised");
+        }
+
         return Core::ERROR_NONE;
     }
 
-    Core::hresult DeviceInfoImplementation::SerialNumber(DeviceSerialNo& deviceSerialNo) const
+    Core::hresult DeviceInfoImplementation::Register(Exchange::IDeviceInfoExtended::INotification* notification)
+    {
+        ASSERT(notification != nullptr);
+
+        _notificationLock.Lock();
+
+        auto index = std::find(_notifications.begin(), _notifications.end(), notification);
+        ASSERT(index == _notifications.end());
+
+        if (index == _notifications.end()) {
+            _notifications.push_back(notification);
+            notification->AddRef();
+        }
+
+        _notificationLock.Unlock();
+
+        return Core::ERROR_NONE;
+    }
+
+    Core::hresult DeviceInfoImplementation::Unregister(Exchange::IDeviceInfoExtended::INotification* notification)
+    {
+        uint32_t result = Core::ERROR_UNKNOWN_KEY;
+
+        ASSERT(notification != nullptr);
+
+        _notificationLock.Lock();
+
+        auto index = std::find(_notifications.begin(), _notifications.end(), notification);
+        ASSERT(index != _notifications.end());
+
+        if (index != _notifications.end()) {
+            (*index)->Release();
+            _notifications.erase(index);
+            result = Core::ERROR_NONE;
+        }
+
+        _notificationLock.Unlock();
+
+        return result;
+    }
+
+    // Also needed without the snapshot: an MFR type rejected as invalid is
+    // skipped until its sources are reset.
+    Core::hresult DeviceInfoImplementation::RefreshIdentity()
+    {
+        WaitForPrefetch();
+
+        for (const std::unique_ptr<ValueSource>& source : _sources) {
+            source->Reset();
+        }
+
+        if (_identityEnabled == true) {
+            TakeSnapshot();
+        }
+
+        return Core::ERROR_NONE;
+    }
+
+    void DeviceInfoImplementation::Prefetch(const uint8_t workers)
+    {
+        static constexpr source MFRSources[] = { MFR_SERIALNUMBER, MFR_MODELNAME, MFR_MANUFACTURER, MFR_PROVISIONED_MODELNAME, MFR_PDRIVERSION };
+        static constexpr uint32_t count = sizeof(MFRSources) / sizeof(MFRSources[0]);
+
+        _prefetchIndex = 0;
+
+        for (uint8_t worker = 0; (worker < workers) && (worker < count); worker++) {
+            _prefetchers.emplace_back([this]() {
+                uint32_t index;
+                while ((index = _prefetchIndex++) < count) {
+                    _sources[MFRSources[index]]->Prefetch();
+                }
+            });
+        }
+    }
+
+    void DeviceInfoImplementation::WaitForPrefetch()
+    {
+        for (std::thread& prefetcher : _prefetchers) {
+            prefetcher.join();
+        }
+        _prefetchers.clear();
+    }
+
+    void DeviceInfoImplementation::TakeSnapshot()
+    {
+        Identity* identity = new Identity();
+
+        if (ResolveSerialNumber(identity->serialNumber) != Core::ERROR_NONE) {
+            identity->serialNumber.clear();
+        }
+        if (ResolveSku(identity->sku) != Core::ERROR_NONE) {
+            identity->sku.clear();
+        }
+        if (ResolveMake(identity->make) != Core::ERROR_NONE) {
+            identity->make.clear();
+        }
+        if (ResolveModel(identity->model) != Core::ERROR_NONE) {
+            identity->model.clear();
+        }
+        if (ResolveSocName(identity->socName) != Core::ERROR_NONE) {
+            identity->socName.clear();
+        }
+        if (ResolveChipset(identity->chipset) != Core::ERROR_NONE) {
+            identity->chipset.clear();
+        }
+
+        LOGINFO("Identity snapshot: serial %s, sku %s, make %s, model %s, soc %s, chipset %s",
+            identity->serialNumber.empty() ? "unresolved" : "cached",
+            identity->sku.empty() ? "unresolved" : "cached",
+            identity->make.empty() ? "unresolved" : "cached",
+            identity->model.empty() ? "unresolved" : "cached",
+            identity->socName.empty() ? "unresolved" : "cached",
+            identity->chipset.empty() ? "unresolved" : "cached");
+
+        _adminLock.Lock();
+        const Identity* previous = _identity.exchange(identity, std::memory_order_acq_rel);
+        if (previous != nullptr) {
+            _retired.push_back(previous);
+        }
+        _adminLock.Unlock();
+    }
+
+    Core::hresult DeviceInfoImplementation::SourceStatistics(string& statistics) const
+    {
+        std::list<ValueSource::Statistics> entries;
+        Statistics(entries);
+
+        JsonArray sources;
+        for (const ValueSource::Statistics& entry : entries) {
+            JsonObject item;
+            item[_T("name")] = entry.name;
+            item[_T("hits")] = entry.hits;
+            item[_T("misses")] = entry.misses;
+            item[_T("skips")] = entry.skips;
+            item[_T("latency")] = entry.latency;
+            sources.Add(item);
+        }
+
+        JsonObject response;
+        response[_T("sources")] = sources;
+        response.ToString(statistics);
+
+        return Core::ERROR_NONE;
+    }
+
+    Core::hresult DeviceInfoImplementation::NetworkAddresses(const string& interfaces, const bool up, const bool hasAddress, const string& family, string& addresses) const
+    {
+        AddressFilter filter;
+
+        filter.pattern = interfaces;
+        filter.up = up;
+        filter.hasAddress = hasAddress;
+        if (filter.Family(family) == false) {
+            return (Core::ERROR_BAD_REQUEST);
+        }
+
+        std::list<NetlinkMonitor::Link> links;
+
+        const uint32_t result = Links(links);
+
+        if (result == Core::ERROR_NONE) {
+            JsonArray entries;
+
+            for (const NetlinkMonitor::Link& link : links) {
+                if (filter.Keeps(link) == false) {
+                    continue;
+                }
+
+                JsonObject entry;
+                JsonArray list;
+
+                for (const NetlinkMonitor::Address& address : link.addresses) {
+                    if (filter.Matches(address) == true) {
+                        JsonObject item;
+                        item[_T("address")] = address.address;
+                        item[_T("family")] = (address.family == AF_INET) ? _T("ipv4") : _T("ipv6");
+                        item[_T("prefix")] = static_cast<uint32_t>(address.prefix);
+                        item[_T("scope")] = ScopeName(address.scope);
+                        list.Add(item);
+                    }
+                }
+
+                entry[_T("name")] = link.name;
+                entry[_T("mac")] = link.mac;
+                entry[_T("addresses")] = list;
+                entries.Add(entry);
+            }
+
+            JsonObject response;
+            response[_T("interfaces")] = entries;
+            response.ToString(addresses);
+        }
+
+        return (result);
+    }
+
+    void DeviceInfoImplementation::Statistics(std::list<ValueSource::Statistics>& statistics) const
+    {
+        for (const std::unique_ptr<ValueSource>& source : _sources) {
+            ValueSource::Statistics entry;
+            source->Snapshot(entry);
+            statistics.push_back(entry);
+        }
+    }
+
+    bool DeviceInfoImplementation::FromIdentity(string Identity::*field, string& value) const
     {
-        return (GetMFRData(mfrSERIALIZED_TYPE_SERIALNUMBER, deviceSerialNo.serialnumber)
-                   == Core::ERROR_NONE)
+        const Identity* identity = _identity.load(std::memory_order_acquire);
+        const bool result = (identity != nullptr) && ((identity->*field).empty() == false);
+
+        if (result == true) {
+            value = identity->*field;
+        }
+
+        return result;
+    }
+
+    uint32_t DeviceInfoImplementation::Lookup(string Identity::*field, const TCHAR key[], uint32_t (DeviceInfoImplementation::*resolve)(string&) const, string& value) const
+    {
+        // The snapshot is served lock-free; only backend reads are coalesced.
+        return (FromIdentity(field, value) == true)
             ? Core::ERROR_NONE
-            : GetRFCData(_T("Device.DeviceInfo.SerialNumber"), deviceSerialNo.serialnumber);
+            : _singleFlight.Do(key, value, [this, resolve](string& result) { return ((this->*resolve)(result)); });
+    }
+
+    Core::hresult DeviceInfoImplementation::SerialNumber(DeviceSerialNo& deviceSerialNo) const
+    {
+        return (Lookup(&Identity::serialNumber, _T("serialnumber"), &DeviceInfoImplementation::ResolveSerialNumber, deviceSerialNo.serialnumber));
+    }
+
+    uint32_t DeviceInfoImplementation::ResolveSerialNumber(string& serialNumber) const
+    {
+        return (_chains[SERIAL_NUMBER]->Resolve(serialNumber));
     }
 
     Core::hresult DeviceInfoImplementation::Sku(DeviceModelNo& deviceModelNo) const
     {
-        return (GetFileRegex(_T("/etc/device.properties"),
-                    std::regex("^MODEL_NUM(?:\\s*)=(?:\\s*)(?:\"{0,1})([^\"\\n]+)(?:\"{0,1})(?:\\s*)$"), deviceModelNo.sku)
-                   == Core::ERROR_NONE)
-            ? Core::ERROR_NONE
-            : ((GetMFRData(mfrSERIALIZED_TYPE_MODELNAME, deviceModelNo.sku)
-                   == Core::ERROR_NONE)
-                    ? Core::ERROR_NONE
-                    : GetRFCData(_T("Device.DeviceInfo.ModelName"), deviceModelNo.sku));
+        return (Lookup(&Identity::sku, _T("sku"), &DeviceInfoImplementation::ResolveSku, deviceModelNo.sku));
+    }
+
+    uint32_t DeviceInfoImplementation::ResolveSku(string& sku) const
+    {
+        return (_chains[SKU]->Resolve(sku));
     }
 
     Core::hresult DeviceInfoImplementation::Make(DeviceMake& deviceMake) const
     {
-        return ( GetMFRData(mfrSERIALIZED_TYPE_MANUFACTURER, deviceMake.make) == Core::ERROR_NONE)
-            ? Core::ERROR_NONE
-            : GetFileRegex(_T("/etc/device.properties"),std::regex("^MFG_NAME(?:\\s*)=(?:\\s*)(?:\"{0,1})([^\"\\n]+)(?:\"{0,1})(?:\\s*)$"), deviceMake.make);
+        return (Lookup(&Identity::make, _T("make"), &DeviceInfoImplementation::ResolveMake, deviceMake.make));
+    }
+
+    uint32_t DeviceInfoImplementation::ResolveMake(string& make) const
+    {
+        return (_chains[MAKE]->Resolve(make));
     }
 
     Core::hresult DeviceInfoImplementation::Model(DeviceModel& deviceModel) const
+    {
+        return (Lookup(&Identity::model, _T("modelid"), &DeviceInfoImplementation::ResolveModel, deviceModel.model));
+    }
+
+    uint32_t DeviceInfoImplementation::ResolveModel(string& model) const
     {
         std::string device_name;
-        uint32_t result = GetFileRegex(_T("/etc/device.properties"), std::regex("^DEVICE_NAME(?:\\s*)=(?:\\s*)(?:\"{0,1})([^\"\\n]+)(?:\"{0,1})(?:\\s*)$"), device_name);
+        uint32_t result = _deviceProperties.Get(FileKeys::DeviceName.key, device_name);
         if ((result == Core::ERROR_NONE) && ((device_name == "PLATCO") || (device_name == "LLAMA"))) {
-            result = (GetMFRData(mfrSERIALIZED_TYPE_PROVISIONED_MODELNAME, deviceModel.model) == Core::ERROR_NONE) ? Core::ERROR_NONE
-		: GetFileRegex(_T("/etc/device.properties"), std::regex("^FRIENDLY_ID(?:\\s*)=(?:\\s*)(?:\"{0,1})([^\"\\n]+)(?:\"{0,1})(?:\\s*)$"), deviceModel.model);
+            result = (_sources[MFR_PROVISIONED_MODELNAME]->Fetch(model) == true) ? Core::ERROR_NONE
+		: _deviceProperties.Get(FileKeys::FriendlyId.key, model);
         } else {
-            result = GetFileRegex(_T("/etc/device.properties"), std::regex("^FRIENDLY_ID(?:\\s*)=(?:\\s*)(?:\"{0,1})([^\"\\n]+)(?:\"{0,1})(?:\\s*)$"), deviceModel.model);
+            result = _deviceProperties.Get(FileKeys::FriendlyId.key, model);
         }
 
         return result;
@@ -171,22 +976,23 @@ namespace Plugin {
     Core::hresult DeviceInfoImplementation::Brand(DeviceBrand& deviceBrand) const
     {
         deviceBrand.brand = "Unknown";
-        return
-            ((Core::ERROR_NONE == GetFileRegex(_T("/tmp/.manufacturer"), std::regex("^([^\\n]+)$"), deviceBrand.brand)) || 
-             (GetMFRData(mfrSERIALIZED_TYPE_MANUFACTURER, deviceBrand.brand) == Core::ERROR_NONE))?Core::ERROR_NONE:Core::ERROR_GENERAL;
+        return (_singleFlight.Do(_T("brand"), deviceBrand.brand, [this](string& brand) { return (_chains[BRAND]->Resolve(brand)); }));
     }
 
     Core::hresult DeviceInfoImplementation::DeviceType(DeviceTypeInfos& deviceTypeInfos) const
+    {
+        return (_singleFlight.Do(_T("devicetype"), deviceTypeInfos, [this](DeviceTypeInfos& result) { return (ResolveDeviceType(result)); }));
+    }
+
+    uint32_t DeviceInfoImplementation::ResolveDeviceType(DeviceTypeInfos& deviceTypeInfos) const
     {
         const char* device_type;
         string deviceTypeInfo;
-        uint32_t result = GetFileRegex(_T("/etc/authService.conf"),
-            std::regex("^deviceType(?:\\s*)=(?:\\s*)(?:\"{0,1})([^\"\\n]+)(?:\"{0,1})(?:\\s*)$"), deviceTypeInfo);
+        uint32_t result = GetFileKey(_files, FileKeys::AuthServiceDeviceType, deviceTypeInfo);
 
         if (result != Core::ERROR_NONE) {
             // If we didn't find the deviceType in authService.conf, try device.properties
-            result = GetFileRegex(_T("/etc/device.properties"),
-                std::regex("^DEVICE_TYPE(?:\\s*)=(?:\\s*)(?:\"{0,1})([^\"\\n]+)(?:\"{0,1})(?:\\s*)$"), deviceTypeInfo);
+            result = _deviceProperties.Get(FileKeys::DevicePropertiesType.key, deviceTypeInfo);
 
             if (result == Core::ERROR_NONE) {
                 // Perform the conversion logic if we found the deviceType in device.properties
@@ -213,30 +1019,33 @@ namespace Plugin {
 
     Core::hresult DeviceInfoImplementation::SocName(DeviceSoc& deviceSoc)  const
     {
-        return (GetFileRegex(_T("/etc/device.properties"),
-                std::regex("^SOC(?:\\s*)=(?:\\s*)(?:\"{0,1})([^\"\\n]+)(?:\"{0,1})(?:\\s*)$"), deviceSoc.socname));
+        return (Lookup(&Identity::socName, _T("socname"), &DeviceInfoImplementation::ResolveSocName, deviceSoc.socname));
+    }
+
+    uint32_t DeviceInfoImplementation::ResolveSocName(string& socName) const
+    {
+        return (_deviceProperties.Get(FileKeys::SocName.key, socName));
     }
 
     Core::hresult DeviceInfoImplementation::DistributorId(DeviceDistId& deviceDistId) const
     {
-        return (GetFileRegex(_T("/opt/www/authService/partnerId3.dat"),
-                    std::regex("^([^\\n]+)$"), deviceDistId.distributorid)
-                   == Core::ERROR_NONE)
-            ? Core::ERROR_NONE
-            : GetRFCData(_T("Device.DeviceInfo.X_RDKCENTRAL-COM_Syndication.PartnerId"), deviceDistId.distributorid);
+        return (_singleFlight.Do(_T("distributorid"), deviceDistId.distributorid, [this](string& distributorId) { return (_chains[DISTRIBUTOR_ID]->Resolve(distributorId)); }));
     }
 
     Core::hresult DeviceInfoImplementation::ReleaseVersion(DeviceReleaseVer& deviceReleaseVer) const
+    {
+        return (_singleFlight.Do(_T("releaseversion"), deviceReleaseVer, [this](DeviceReleaseVer& result) { return (ResolveReleaseVersion(result)); }));
+    }
+
+    uint32_t DeviceInfoImplementation::ResolveReleaseVersion(DeviceReleaseVer& deviceReleaseVer) const
     {
         const std::string defaultVersion = "99.99.0.0";
-        std::regex pattern(R"((\d+)\.(\d+)[sp])");
-        std::smatch match;
         std::string imagename = "";
-        if(Core::ERROR_NONE == GetFileRegex(_T("/version.txt"), std::regex("^imagename:([^\\n]+)$"), imagename))
+        if(Core::ERROR_NONE == _versionFile.Get(FileKeys::ImageName, imagename))
         {
-            if (std::regex_search(imagename, match, pattern)) {
-                std::string major = match[1];
-                std::string minor = match[2];
+            std::string major;
+            std::string minor;
+            if (ReleaseNumbers(imagename, major, minor)) {
                 deviceReleaseVer.releaseversion = major + "." + minor + ".0.0";
             }
             else
@@ -257,34 +1066,40 @@ namespace Plugin {
 
     Core::hresult DeviceInfoImplementation::ChipSet(DeviceChip& deviceChip) const
     {
-        auto result = GetFileRegex(_T("/etc/device.properties"),std::regex("^CHIPSET_NAME(?:\\s*)=(?:\\s*)(?:\"{0,1})([^\"\\n]+)(?:\"{0,1})(?:\\s*)$"), deviceChip.chipset);
+        return (Lookup(&Identity::chipset, _T("chipset"), &DeviceInfoImplementation::ResolveChipset, deviceChip.chipset));
+    }
+
+    uint32_t DeviceInfoImplementation::ResolveChipset(string& chipset) const
+    {
+        auto result = _deviceProperties.Get(FileKeys::ChipsetName.key, chipset);
         return result;
     }
 
     Core::hresult DeviceInfoImplementation::FirmwareVersion(FirmwareversionInfo& firmwareVersionInfo) const
+    {
+        return (_singleFlight.Do(_T("firmwareversion"), firmwareVersionInfo, [this](FirmwareversionInfo& result) { return (ResolveFirmwareVersion(result)); }));
+    }
+
+    uint32_t DeviceInfoImplementation::ResolveFirmwareVersion(FirmwareversionInfo& firmwareVersionInfo) const
     {
         uint32_t result = Core::ERROR_GENERAL;
 
-        result = GetFileRegex(_T("/version.txt"), std::regex("^imagename:([^\\n]+)$"), firmwareVersionInfo.imagename);
-        
-        if (result == Core::ERROR_NONE )
-        {
-            if (GetFileRegex(_T("/version.txt"), std::regex("^SDK_VERSION=([^\\n]+)$"), firmwareVersionInfo.sdk) != Core::ERROR_NONE)
-            {
-                firmwareVersionInfo.sdk = "";
-            }
+        static const FileKey* const Keys[] = { &FileKeys::ImageName, &FileKeys::SdkVersion, &FileKeys::MediaRite, &FileKeys::YoctoVersion };
+        static_assert((sizeof(Keys) / sizeof(Keys[0])) == VERSION_FIELDS, "Keys table does not match the version enum");
+        string values[VERSION_FIELDS];
 
-            if (GetFileRegex(_T("/version.txt"), std::regex("^MEDIARITE=([^\\n]+)$"), firmwareVersionInfo.mediarite) != Core::ERROR_NONE)
-            {
-                firmwareVersionInfo.mediarite = "";
-            }
+        // All /version.txt fields come from the same parse of the file.
+        const uint32_t found = _versionFile.Get(VERSION_FIELDS, Keys, values);
 
-            if (GetFileRegex(_T("/version.txt"), std::regex("^YOCTO_VERSION=([^\\n]+)$"), firmwareVersionInfo.yocto) != Core::ERROR_NONE)
-            {
-                firmwareVersionInfo.yocto = "";
-            }
+        if ((found & (1u << VERSION_IMAGENAME)) != 0)
+        {
+            result = Core::ERROR_NONE;
+            firmwareVersionInfo.imagename = values[VERSION_IMAGENAME];
+            firmwareVersionInfo.sdk = values[VERSION_SDK];
+            firmwareVersionInfo.mediarite = values[VERSION_MEDIARITE];
+            firmwareVersionInfo.yocto = values[VERSION_YOCTO];
 
-            if (GetMFRData(mfrSERIALIZED_TYPE_PDRIVERSION, firmwareVersionInfo.pdri) != Core::ERROR_NONE)
+            if (_sources[MFR_PDRIVERSION]->Fetch(firmwareVersionInfo.pdri) == false)
             {
                 firmwareVersionInfo.pdri = "";
             }
@@ -295,178 +1110,636 @@ namespace Plugin {
 
     Core::hresult DeviceInfoImplementation::SystemInfo(SystemInfos& systemInfo) const
     {
-        DeviceSerialNo deviceSerial;
-        struct timespec currentTime{};
+        const uint32_t result = LatestSystemInfo(systemInfo, true);
 
-        PluginHost::ISubSystem* _subSystem = nullptr;
-        _subSystem = _service->SubSystems();
-        ASSERT(_subSystem != nullptr);
-        SerialNumber(deviceSerial);
-        Core::SystemInfo& singleton(Core::SystemInfo::Instance());
-        clock_gettime(CLOCK_REALTIME, &currentTime);
-        systemInfo.time = Core::Time(currentTime).ToRFC1123(true);
-        if (_subSystem != nullptr) {
-            systemInfo.version = _subSystem->Version() + _T("#") + _subSystem->BuildTreeHash();
+        if (result == Core::ERROR_NONE) {
+            systemInfo.time = CurrentTime();
+        }
+
+        return (result);
+    }
+
+    // The sampler's latest record when it runs. Otherwise a sample taken on
+    // the spot, which only looks the serial number and version up with identity.
+    uint32_t DeviceInfoImplementation::LatestSystemInfo(SystemInfos& systemInfo, const bool identity) const
+    {
+        uint64_t sampled = 0;
+        uint32_t result = Core::ERROR_NONE;
+
+        if (_sampler.Latest(systemInfo, sampled) == true) {
+            // The uptime moved on since the sample was taken.
+            systemInfo.uptime += (Core::Time::Now().Ticks() - sampled) / (1000 * Core::Time::TicksPerMillisecond);
+        } else if (identity == true) {
+            result = _singleFlight.Do(_T("systeminfo"), systemInfo, [this](SystemInfos& info) { return (ResolveSystemInfo(info)); });
+        } else {
+            ProcfsReader::Figures figures;
+            _procfs.Sample(_cpu, figures);
+            systemInfo = SystemInfos();
+            SampleSystemInfo(systemInfo, figures, false);
+        }
+
+        return (result);
+    }
+
+    // Only the members asked for end up in the answer; the serial number and
+    // version lookups are skipped unless one of them is among them.
+    Core::hresult DeviceInfoImplementation::SystemInfoFields(const string& fields, string& info) const
+    {
+        uint16_t mask = 0;
+
+        if (fields.empty() == false) {
+            JsonArray names;
+            if (names.FromString(fields) == false) {
+                return (Core::ERROR_BAD_REQUEST);
+            }
+
+            for (uint16_t index = 0; index < names.Length(); index++) {
+                if (names[index].Content() != JsonValue::type::STRING) {
+                    return (Core::ERROR_BAD_REQUEST);
+                }
+                const string name = names[index].String();
+                uint16_t field = 0;
+                for (const auto& entry : SystemInfoFieldNames) {
+                    if (name == entry.name) {
+                        field = entry.field;
+                        break;
+                    }
+                }
+                if (field == 0) {
+                    return (Core::ERROR_BAD_REQUEST);
+                }
+                mask |= field;
+            }
+        }
+
+        if (mask == 0) {
+            mask = ~static_cast<uint16_t>(0);
+        }
+
+        SystemInfos systemInfo{};
+        const uint32_t result = LatestSystemInfo(systemInfo, ((mask & (FIELD_SERIALNUMBER | FIELD_VERSION)) != 0));
+
+        if (result == Core::ERROR_NONE) {
+            JsonObject response;
+
+            if ((mask & FIELD_VERSION) != 0) {
+                response[_T("version")] = systemInfo.version;
+            }
+            if ((mask & FIELD_UPTIME) != 0) {
+                response[_T("uptime")] = systemInfo.uptime;
+            }
+            if ((mask & FIELD_TOTALRAM) != 0) {
+                response[_T("totalram")] = systemInfo.totalram;
+            }
+            if ((mask & FIELD_FREERAM) != 0) {
+                response[_T("freeram")] = systemInfo.freeram;
+            }
+            if ((mask & FIELD_TOTALSWAP) != 0) {
+                response[_T("totalswap")] = systemInfo.totalswap;
+            }
+            if ((mask & FIELD_FREESWAP) != 0) {
+                response[_T("freeswap")] = systemInfo.freeswap;
+            }
+            if ((mask & FIELD_DEVICENAME) != 0) {
+                response[_T("devicename")] = systemInfo.devicename;
+            }
+            if ((mask & FIELD_CPULOAD) != 0) {
+                response[_T("cpuload")] = systemInfo.cpuload;
+            }
+            if ((mask & FIELD_CPULOADAVG) != 0) {
+                JsonObject average;
+                average[_T("avg1min")] = systemInfo.cpuloadavg.avg1min;
+                average[_T("avg5min")] = systemInfo.cpuloadavg.avg5min;
+                average[_T("avg15min")] = systemInfo.cpuloadavg.avg15min;
+                response[_T("cpuloadavg")] = average;
+            }
+            if ((mask & FIELD_SERIALNUMBER) != 0) {
+                response[_T("serialnumber")] = systemInfo.serialnumber;
+            }
+            if ((mask & FIELD_TIME) != 0) {
+                response[_T("time")] = CurrentTime();
+            }
+            if ((mask & (FIELD_AVAILABLERAM | FIELD_CACHEDRAM | FIELD_CMAFREE)) != 0) {
+                // Not part of SystemInfos, and without a sysinfo() equivalent.
+                ProcfsReader::Memory memory;
+                if (_procfs.Meminfo(memory) != Core::ERROR_NONE) {
+                    memory = {};
+                }
+                if ((mask & FIELD_AVAILABLERAM) != 0) {
+                    response[_T("availableram")] = memory.available;
+                }
+                if ((mask & FIELD_CACHEDRAM) != 0) {
+                    response[_T("cachedram")] = memory.cached;
+                }
+                if ((mask & FIELD_CMAFREE) != 0) {
+                    response[_T("cmafree")] = memory.cmaFree;
+                }
+            }
+
+            response.ToString(info);
         }
+
+        return (result);
+    }
+
+    uint32_t DeviceInfoImplementation::ResolveSystemInfo(SystemInfos& systemInfo) const
+    {
+        SystemInfos info{};
+        ProcfsReader::Figures figures;
+
+        _procfs.Sample(_cpu, figures);
+        SampleSystemInfo(info, figures, true);
+        systemInfo = info;
+
+        return Core::ERROR_NONE;
+    }
+
+    // The version and the serial number are only looked up with identity.
+    void DeviceInfoImplementation::SampleSystemInfo(SystemInfos& systemInfo, const ProcfsReader::Figures& figures, const bool identity) const
+    {
+        // The version and the serial number are kept from the previous sample once known.
+        if ((identity == true) && (systemInfo.version.empty() == true)) {
+            PluginHost::ISubSystem* _subSystem = nullptr;
+            _subSystem = _service->SubSystems();
+            ASSERT(_subSystem != nullptr);
+            if (_subSystem != nullptr) {
+                systemInfo.version = _subSystem->Version() + _T("#") + _subSystem->BuildTreeHash();
+                _subSystem->Release();
+            }
+        }
+        if ((identity == true) && (systemInfo.serialnumber.empty() == true)) {
+            DeviceSerialNo deviceSerial;
+            SerialNumber(deviceSerial);
+            systemInfo.serialnumber = deviceSerial.serialnumber;
+        }
+
+        Core::SystemInfo& singleton(Core::SystemInfo::Instance());
         systemInfo.uptime = singleton.GetUpTime();
-        systemInfo.freeram = singleton.GetFreeRam();
-        systemInfo.totalram = singleton.GetTotalRam();
-        systemInfo.totalswap = singleton.GetTotalSwap();
-        systemInfo.freeswap = singleton.GetFreeSwap();
         systemInfo.devicename = singleton.GetHostName();
-        systemInfo.cpuload = Core::NumberType<uint32_t>(static_cast<uint32_t>(singleton.GetCpuLoad())).Text();
-        systemInfo.serialnumber = deviceSerial.serialnumber;
-        auto cpuloadavg = singleton.GetCpuLoadAvg();
-        if (cpuloadavg != nullptr) {
-            systemInfo.cpuloadavg.avg1min = *(cpuloadavg);
-            if (++cpuloadavg != nullptr) {
-                systemInfo.cpuloadavg.avg5min = *(cpuloadavg);
-                if (++cpuloadavg != nullptr) {
-                    systemInfo.cpuloadavg.avg15min = *(cpuloadavg);
+
+        systemInfo.freeram = figures.memory.free;
+        systemInfo.totalram = figures.memory.total;
+        systemInfo.totalswap = figures.memory.swapTotal;
+        systemInfo.freeswap = figures.memory.swapFree;
+        systemInfo.cpuload = Core::NumberType<uint32_t>(figures.cpuLoad).Text();
+        systemInfo.cpuloadavg.avg1min = figures.averages[0];
+        systemInfo.cpuloadavg.avg5min = figures.averages[1];
+        systemInfo.cpuloadavg.avg15min = figures.averages[2];
+    }
+
+    // Runs on the sampler thread.
+    void DeviceInfoImplementation::Sample(SystemInfos& systemInfo)
+    {
+        ProcfsReader::Figures figures;
+
+        _procfs.Sample(_samplerCpu, figures);
+        SampleSystemInfo(systemInfo, figures, true);
+
+        const Plugin::SystemInfoHistory::Entry entry = {
+            Core::Time::Now().Ticks(),
+            figures.cpuLoad,
+            figures.memory.free,
+            figures.memory.swapFree,
+            figures.averages[0],
+            figures.averages[1],
+            figures.averages[2]
+        };
+        _history.Add(entry);
+
+        SampleThermal();
+    }
+
+    // Runs on the sampler thread. Raises ThermalThreshold when a zone reaches
+    // the configured threshold and again once it dropped below it by the
+    // hysteresis.
+    void DeviceInfoImplementation::SampleThermal()
+    {
+        std::list<ThermalThreshold::Crossing> crossings;
+
+        // Read outside the lock into the spare sample, whose storage is reused
+        // from the previous swap, and publish it by swapping.
+        if (_thermalReader.Read(_thermalSpare) != Core::ERROR_NONE) {
+            return;
+        }
+
+        _thermalLock.Lock();
+
+        std::swap(_thermal, _thermalSpare);
+        _thermalSampled = Core::Time::Now().Ticks();
+
+        _thermalThreshold.Update(_thermal.zones, crossings);
+
+        _thermalLock.Unlock();
+
+        if (crossings.empty() == false) {
+            _notificationLock.Lock();
+            for (const ThermalThreshold::Crossing& crossing : crossings) {
+                for (Exchange::IDeviceInfoExtended::INotification* notification : _notifications) {
+                    notification->ThermalThreshold(crossing.zone, crossing.temperature, crossing.above);
                 }
             }
+            _notificationLock.Unlock();
         }
+    }
 
-        if (_subSystem != nullptr) {
-            _subSystem->Release();
+    Core::hresult DeviceInfoImplementation::SystemInfoHistory(const uint32_t window, string& samples) const
+    {
+        if (_history.Capacity() == 0) {
+            return (Core::ERROR_UNAVAILABLE);
         }
 
-        return Core::ERROR_NONE;
+        std::list<Plugin::SystemInfoHistory::Entry> entries;
+        _history.Entries(window, entries);
+
+        JsonArray list;
+        for (const Plugin::SystemInfoHistory::Entry& entry : entries) {
+            JsonObject sample;
+            sample[_T("time")] = entry.time / Core::Time::TicksPerMillisecond;
+            sample[_T("cpuload")] = entry.cpuload;
+            sample[_T("freeram")] = entry.freeram;
+            sample[_T("freeswap")] = entry.freeswap;
+            sample[_T("avg1min")] = entry.avg1min;
+            sample[_T("avg5min")] = entry.avg5min;
+            sample[_T("avg15min")] = entry.avg15min;
+            list.Add(sample);
+        }
+
+        JsonObject response;
+        response[_T("samples")] = list;
+        response.ToString(samples);
+
+        return (Core::ERROR_NONE);
     }
 
-    Core::hresult DeviceInfoImplementation::Addresses(IAddressesInfoIterator*& addressesInfo) const
+    // While the sampler runs this is its latest sample and costs no sysfs
+    // read; otherwise the attributes are read on the spot.
+    Core::hresult DeviceInfoImplementation::ThermalInfo(string& info) const
     {
-        std::list<AddressesInfo> deviceAddressesInfoList;
-        AddressesInfo deviceAddressInfo;
-        Core::JSON::String nodeName;
-        Core::AdapterIterator interfaces;
+        ThermalReader::Sample sample;
+        uint64_t sampled = 0;
+        uint32_t result = Core::ERROR_NONE;
 
-        while (interfaces.Next() == true) {
+        _thermalLock.Lock();
+        if (_thermalSampled != 0) {
+            sample = _thermal;
+            sampled = _thermalSampled;
+        }
+        _thermalLock.Unlock();
 
-            deviceAddressInfo.name = interfaces.Name();
-            deviceAddressInfo.mac = interfaces.MACAddress(':');
+        if (sampled == 0) {
+            result = _thermalReader.Read(sample);
+            sampled = Core::Time::Now().Ticks();
+        }
 
-            // get an interface with a public IP address, then we will have a proper MAC address..
-            Core::IPV4AddressIterator selectedNode(interfaces.IPV4Addresses());
+        if (result == Core::ERROR_NONE) {
+            JsonArray zones;
+            for (const ThermalReader::Zone& zone : sample.zones) {
+                JsonObject entry;
+                entry[_T("name")] = zone.name;
+                entry[_T("temperature")] = zone.temperature;
+                zones.Add(entry);
+            }
 
-            while (selectedNode.Next() == true) {
-                nodeName = selectedNode.Address().HostAddress();
+            JsonArray coolings;
+            for (const ThermalReader::Cooling& cooling : sample.coolings) {
+                JsonObject entry;
+                entry[_T("name")] = cooling.name;
+                entry[_T("state")] = cooling.state;
+                entry[_T("maxstate")] = cooling.maxState;
+                entry[_T("transitions")] = cooling.transitions;
+                coolings.Add(entry);
             }
 
-            deviceAddressInfo.ip = nodeName.Value();
+            JsonArray cpus;
+            for (const ThermalReader::Cpu& cpu : sample.cpus) {
+                JsonObject entry;
+                entry[_T("cpu")] = cpu.id;
+                entry[_T("frequency")] = cpu.frequency;
+                entry[_T("maxfrequency")] = cpu.maxFrequency;
+                cpus.Add(entry);
+            }
+
+            JsonObject response;
+            response[_T("zones")] = zones;
+            response[_T("coolingdevices")] = coolings;
+            response[_T("cpus")] = cpus;
+            response[_T("time")] = sampled / Core::Time::TicksPerMillisecond;
+            response.ToString(info);
+        }
+
+        return (result);
+    }
 
-            deviceAddressesInfoList.push_back(deviceAddressInfo);
+    // Runs on the pressure monitor thread.
+    void DeviceInfoImplementation::PressureStall(const PressureMonitor::resource which)
+    {
+        PressureMonitor::Pressure pressure;
+        string text;
 
+        if (PressureMonitor::Read(which, pressure) == Core::ERROR_NONE) {
+            PressureObject(pressure).ToString(text);
         }
-        
-        addressesInfo = Core::Service<RPC::IteratorType<Exchange::IDeviceInfo::IAddressesInfoIterator>> \
-                                    ::Create<Exchange::IDeviceInfo::IAddressesInfoIterator>(deviceAddressesInfoList);
 
-        return Core::ERROR_NONE;
+        _notificationLock.Lock();
+        for (Exchange::IDeviceInfoExtended::INotification* notification : _notifications) {
+            notification->PressureStall(PressureMonitor::Name(which), text);
+        }
+        _notificationLock.Unlock();
     }
 
-    Core::hresult DeviceInfoImplementation::EthMac(EthernetMac& ethernetMac) const
+    // The implementation is only reported when it does not run in the host.
+    Core::hresult DeviceInfoImplementation::MemoryPressure(const uint32_t host, string& pressure) const
     {
-        FILE* fp = v_secure_popen("r", "/lib/rdk/getDeviceDetails.sh read eth_mac");
-        if (!fp) {
-            return Core::ERROR_GENERAL;
-    	}
+        JsonObject response;
+
+        for (uint8_t index = 0; index < PressureMonitor::RESOURCES; index++) {
+            const PressureMonitor::resource which = static_cast<PressureMonitor::resource>(index);
+            PressureMonitor::Pressure figures;
 
-        std::ostringstream oss;
-        char buffer[256];
-        while (fgets(buffer, sizeof(buffer), fp) != nullptr) {
-            oss << buffer;
+            if (PressureMonitor::Read(which, figures) == Core::ERROR_NONE) {
+                response[PressureMonitor::Name(which)] = PressureObject(figures);
+            }
         }
-        v_secure_pclose(fp);
 
-        ethernetMac.ethMac = oss.str();
+        JsonObject process;
+        if (ProcessObject(static_cast<pid_t>(host), process) == true) {
+            response[_T("host")] = process;
+        }
 
-        // Remove trailing newline if present
-        if (!ethernetMac.ethMac.empty() && ethernetMac.ethMac.back() == '\n') {
-             ethernetMac.ethMac.pop_back();
+        const pid_t self = getpid();
+        if (static_cast<uint32_t>(self) != host) {
+            JsonObject implementation;
+            if (ProcessObject(self, implementation) == true) {
+                response[_T("implementation")] = implementation;
+            }
         }
 
-        return Core::ERROR_NONE;
+        response.ToString(pressure);
+
+        return (Core::ERROR_NONE);
     }
 
-    Core::hresult DeviceInfoImplementation::EstbMac(StbMac& stbMac) const
+    Core::hresult DeviceInfoImplementation::Addresses(IAddressesInfoIterator*& addressesInfo) const
     {
-        FILE* fp = v_secure_popen("r", "/lib/rdk/getDeviceDetails.sh read estb_mac");
-        if (!fp) {
-                return Core::ERROR_GENERAL;
+        std::list<AddressesInfo> deviceAddressesInfoList;
+
+        const uint32_t result = _singleFlight.Do(_T("addresses"), deviceAddressesInfoList, [this](std::list<AddressesInfo>& addresses) { return (ResolveAddresses(addresses)); });
+
+        if (result == Core::ERROR_NONE) {
+            addressesInfo = Core::Service<RPC::IteratorType<Exchange::IDeviceInfo::IAddressesInfoIterator>> \
+                                        ::Create<Exchange::IDeviceInfo::IAddressesInfoIterator>(deviceAddressesInfoList);
         }
 
-        std::ostringstream oss;
-        char buffer[256];
-        while (fgets(buffer, sizeof(buffer), fp) != nullptr) {
-                oss << buffer;
+        return result;
+    }
+
+    uint32_t DeviceInfoImplementation::ResolveAddresses(std::list<AddressesInfo>& deviceAddressesInfoList) const
+    {
+        std::list<NetlinkMonitor::Link> links;
+
+        _addressesLock.Lock();
+        const AddressFilter filter(_addressFilter);
+        _addressesLock.Unlock();
+
+        if (_monitor.Running() == true) {
+            // Taken before the model is read, so a change racing with it only makes the next call rebuild.
+            const uint32_t generation = _monitor.Generation();
+            bool cached = false;
+
+            _addressesLock.Lock();
+            if (generation == _addressesGeneration) {
+                deviceAddressesInfoList = _addresses;
+                cached = true;
+            }
+            _addressesLock.Unlock();
+
+            if (cached == false) {
+                Links(links);
+                AddressesFromLinks(links, filter, deviceAddressesInfoList);
+
+                _addressesLock.Lock();
+                _addresses = deviceAddressesInfoList;
+                _addressesGeneration = generation;
+                _addressesLock.Unlock();
+            }
+
+            return Core::ERROR_NONE;
         }
-        v_secure_pclose(fp);
 
-        stbMac.estbMac = oss.str();
+        if (Links(links) != Core::ERROR_NONE) {
+            Core::AdapterIterator interfaces;
 
-        // Remove trailing newline if present
-        if (!stbMac.estbMac.empty() && stbMac.estbMac.back() == '\n') {
-                stbMac.estbMac.pop_back();
+            while (interfaces.Next() == true) {
+                NetlinkMonitor::Link link;
+                link.name = interfaces.Name();
+                link.mac = interfaces.MACAddress(':');
+                link.flags = (interfaces.IsUp() == true) ? IFF_UP : 0;
+
+                Core::IPV4AddressIterator selectedNode(interfaces.IPV4Addresses());
+
+                while (selectedNode.Next() == true) {
+                    link.addresses.push_back({ AF_INET, selectedNode.Address().HostAddress(), 0, RT_SCOPE_UNIVERSE });
+                }
+
+                links.push_back(std::move(link));
+            }
         }
 
+        AddressesFromLinks(links, filter, deviceAddressesInfoList);
+
         return Core::ERROR_NONE;
     }
- 
+
+    uint32_t DeviceInfoImplementation::Netlink(const int descriptor)
+    {
+        _monitor.Stop();
+        const uint32_t result = _monitor.Start(&_monitorSink, descriptor);
+        MonitorStarted();
+
+        return (result);
+    }
+
+    // Points the network lookups at the monitor and takes the ESTB IP it
+    // starts with as the one EstbIpChanged is reported against.
+    void DeviceInfoImplementation::MonitorStarted()
+    {
+        _network.Source(&_monitor);
+
+        string estbIp;
+        if (_monitor.Running() == true) {
+            _network.IPAddress(NetworkInterfaces::ESTB, estbIp);
+        }
+        _notificationLock.Lock();
+        _estbIp = estbIp;
+        _notificationLock.Unlock();
+    }
+
+    // The live model while the monitor runs; otherwise one dump, as nothing
+    // would tell a kept copy of it is stale.
+    uint32_t DeviceInfoImplementation::Links(std::list<NetlinkMonitor::Link>& links) const
+    {
+        if (_monitor.Running() == true) {
+            _monitor.Links(links);
+            return (Core::ERROR_NONE);
+        }
+
+        return (NetlinkMonitor::Dump(links));
+    }
+
+    Core::hresult DeviceInfoImplementation::EthMac(EthernetMac& ethernetMac) const
+    {
+        return (_singleFlight.Do(_T("ethmac"), ethernetMac, [this](EthernetMac& result) { return (ResolveEthMac(result)); }));
+    }
+
+    uint32_t DeviceInfoImplementation::ResolveEthMac(EthernetMac& ethernetMac) const
+    {
+        return ((_details == DETAILS_NATIVE) ? _network.MACAddress(NetworkInterfaces::ETHERNET, ethernetMac.ethMac) : DeviceDetail(NetworkKeys::EthMac.key, ethernetMac.ethMac));
+    }
+
+    Core::hresult DeviceInfoImplementation::EstbMac(StbMac& stbMac) const
+    {
+        return (_singleFlight.Do(_T("estbmac"), stbMac, [this](StbMac& result) { return (ResolveEstbMac(result)); }));
+    }
+
+    uint32_t DeviceInfoImplementation::ResolveEstbMac(StbMac& stbMac) const
+    {
+        return ((_details == DETAILS_NATIVE) ? _network.MACAddress(NetworkInterfaces::ESTB, stbMac.estbMac) : DeviceDetail(NetworkKeys::EstbMac.key, stbMac.estbMac));
+    }
+
     Core::hresult DeviceInfoImplementation::WifiMac(WiFiMac& wiFiMac) const
     {
-        FILE* fp = v_secure_popen("r", "/lib/rdk/getDeviceDetails.sh read wifi_mac");
-        if (!fp) {
-                return Core::ERROR_GENERAL;
+        return (_singleFlight.Do(_T("wifimac"), wiFiMac, [this](WiFiMac& result) { return (ResolveWifiMac(result)); }));
+    }
+
+    uint32_t DeviceInfoImplementation::ResolveWifiMac(WiFiMac& wiFiMac) const
+    {
+        return ((_details == DETAILS_NATIVE) ? _network.MACAddress(NetworkInterfaces::WIFI, wiFiMac.wifiMac) : DeviceDetail(NetworkKeys::WifiMac.key, wiFiMac.wifiMac));
+    }
+
+    Core::hresult DeviceInfoImplementation::EstbIp(StbIp& stbIp) const
+    {
+        return (_singleFlight.Do(_T("estbip"), stbIp, [this](StbIp& result) { return (ResolveEstbIp(result)); }));
+    }
+
+    uint32_t DeviceInfoImplementation::ResolveEstbIp(StbIp& stbIp) const
+    {
+        return ((_details == DETAILS_NATIVE) ? _network.IPAddress(NetworkInterfaces::ESTB, stbIp.estbIp) : DeviceDetail(NetworkKeys::EstbIp.key, stbIp.estbIp));
+    }
+
+    Core::hresult DeviceInfoImplementation::NetworkIdentity(string& ethMac, string& estbMac, string& wifiMac, string& estbIp) const
+    {
+        NetworkFields fields;
+
+        const uint32_t result = _singleFlight.Do(_T("networkidentity"), fields, [this](NetworkFields& resolved) { return (ResolveNetworkIdentity(resolved)); });
+
+        if (result == Core::ERROR_NONE) {
+            ethMac = fields.values[NETWORK_ETH_MAC];
+            estbMac = fields.values[NETWORK_ESTB_MAC];
+            wifiMac = fields.values[NETWORK_WIFI_MAC];
+            estbIp = fields.values[NETWORK_ESTB_IP];
         }
 
-        std::ostringstream oss;
-        char buffer[256];
-        while (fgets(buffer, sizeof(buffer), fp) != nullptr) {
-                oss << buffer;
+        return (result);
+    }
+
+    // One script "read" without a field covers all four; a field it does not
+    // report that way is read on its own, unless that run timed out.
+    uint32_t DeviceInfoImplementation::ResolveNetworkIdentity(NetworkFields& fields) const
+    {
+        static const FileKey* const Keys[] = { &NetworkKeys::EthMac, &NetworkKeys::EstbMac, &NetworkKeys::WifiMac, &NetworkKeys::EstbIp };
+        static_assert((sizeof(Keys) / sizeof(Keys[0])) == NETWORK_FIELDS, "Keys table does not match the network enum");
+
+        uint32_t results[NETWORK_FIELDS];
+
+        if (_details == DETAILS_NATIVE) {
+            results[NETWORK_ETH_MAC] = _network.MACAddress(NetworkInterfaces::ETHERNET, fields.values[NETWORK_ETH_MAC]);
+            results[NETWORK_ESTB_MAC] = _network.MACAddress(NetworkInterfaces::ESTB, fields.values[NETWORK_ESTB_MAC]);
+            results[NETWORK_WIFI_MAC] = _network.MACAddress(NetworkInterfaces::WIFI, fields.values[NETWORK_WIFI_MAC]);
+            results[NETWORK_ESTB_IP] = _network.IPAddress(NetworkInterfaces::ESTB, fields.values[NETWORK_ESTB_IP]);
+        } else {
+            string output;
+            const uint32_t run = DeviceDetail(_T(""), output);
+            const uint32_t found = (run == Core::ERROR_NONE) ? FileKey::Find(output, NETWORK_FIELDS, Keys, fields.values) : 0;
+
+            for (uint8_t index = 0; index < NETWORK_FIELDS; index++) {
+                if ((found & (1u << index)) != 0) {
+                    results[index] = Core::ERROR_NONE;
+                } else if (run == Core::ERROR_TIMEDOUT) {
+                    results[index] = run;
+                } else {
+                    results[index] = DeviceDetail(Keys[index]->key, fields.values[index]);
+                }
+            }
         }
-        v_secure_pclose(fp);
 
-        wiFiMac.wifiMac = oss.str();
- 
-        // Remove trailing newline if present
-        if (!wiFiMac.wifiMac.empty() && wiFiMac.wifiMac.back() == '\n') {
-                wiFiMac.wifiMac.pop_back();
+        uint32_t result = results[0];
+        for (uint8_t index = 0; index < NETWORK_FIELDS; index++) {
+            if (results[index] == Core::ERROR_NONE) {
+                result = Core::ERROR_NONE;
+            } else {
+                fields.values[index].clear();
+            }
         }
 
-        return Core::ERROR_NONE;
+        return (result);
     }
 
-    Core::hresult DeviceInfoImplementation::EstbIp(StbIp& stbIp) const
+    // Runs on the monitor thread; an empty name means the whole model was rebuilt.
+    void DeviceInfoImplementation::AddressChanged(const string& interfaceName)
     {
-        FILE* fp = v_secure_popen("r", "/lib/rdk/getDeviceDetails.sh read estb_ip");
-        if (!fp) {
-                return Core::ERROR_GENERAL;
+        if ((interfaceName.empty() == false) && (interfaceName != _network.Interface(NetworkInterfaces::ESTB))) {
+            return;
         }
 
-        std::ostringstream oss;
-        char buffer[256];
-        while (fgets(buffer, sizeof(buffer), fp) != nullptr) {
-                oss << buffer;
+        string ip;
+        _network.IPAddress(NetworkInterfaces::ESTB, ip);
+
+        _notificationLock.Lock();
+        if (ip != _estbIp) {
+            _estbIp = ip;
+            for (Exchange::IDeviceInfoExtended::INotification* notification : _notifications) {
+                notification->EstbIpChanged(ip);
+            }
         }
-        v_secure_pclose(fp);
+        _notificationLock.Unlock();
+    }
+
+    uint32_t DeviceInfoImplementation::DeviceDetail(const TCHAR field[], string& value) const
+    {
+        uint32_t result = (_details == DETAILS_COPROCESS) ? _coprocess.Read(field, value) : Core::ERROR_UNAVAILABLE;
 
-        stbIp.estbIp = oss.str();
+        // A helper that can not be (re)started leaves the per-request script as the source.
+        if (result == Core::ERROR_UNAVAILABLE) {
+            const char* const arguments[] = { _script.c_str(), "read", field, nullptr };
+            result = _executor.Execute(arguments, value);
 
-        // Remove trailing newline if present
-        if (!stbIp.estbIp.empty() && stbIp.estbIp.back() == '\n') {
-                stbIp.estbIp.pop_back();
+            // Remove trailing newline if present
+            if ((result == Core::ERROR_NONE) && !value.empty() && value.back() == '\n') {
+                value.pop_back();
+            }
         }
 
-        return Core::ERROR_NONE;
+        return result;
     }
 
     Core::hresult DeviceInfoImplementation::SupportedAudioPorts(RPC::IStringIterator*& supportedAudioPorts, bool& success) const
     {
-        uint32_t result = Core::ERROR_NONE;
-
         std::list<string> list;
 
+        const uint32_t result = _singleFlight.Do(_T("supportedaudioports"), list, [this](std::list<string>& audioPorts) { return (ResolveAudioPorts(audioPorts)); });
+
+        if (result == Core::ERROR_NONE) {
+            supportedAudioPorts = (Core::Service<RPC::StringIterator>::Create<RPC::IStringIterator>(list));
+            success = true;
+        }
+
+        return result;
+    }
+
+    uint32_t DeviceInfoImplementation::ResolveAudioPorts(std::list<string>& list) const
+    {
+        uint32_t result = Core::ERROR_NONE;
+
         try {
             const auto& aPorts = device::Host::getInstance().getAudioOutputPorts();
             for (size_t i = 0; i < aPorts.size(); i++) {
@@ -482,11 +1755,6 @@ namespace Plugin {
             result = Core::ERROR_GENERAL;
         }
 
-        if (result == Core::ERROR_NONE) {
-            supportedAudioPorts = (Core::Service<RPC::StringIterator>::Create<RPC::IStringIterator>(list));
-            success = true;
-        }
-
         return result;
     }
 }
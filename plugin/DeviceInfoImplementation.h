@@ -20,6 +20,22 @@
 #pragma once
 
 #include "Module.h"
+#include "AddressFilter.h"
+#include "CircuitBreaker.h"
+#include "DeviceDetailsCoprocess.h"
+#include "DevicePropertiesStore.h"
+#include "FileCache.h"
+#include "FileKey.h"
+#include "IDeviceInfoExtended.h"
+#include "NetworkInterfaces.h"
+#include "PressureMonitor.h"
+#include "ProcfsReader.h"
+#include "ResolutionChain.h"
+#include "ScriptExecutor.h"
+#include "SingleFlight.h"
+#include "SystemInfoHistory.h"
+#include "SystemInfoSampler.h"
+#include "ThermalReader.h"
 
 #include <interfaces/Ids.h>
 #include <interfaces/IDeviceInfo.h>
@@ -28,9 +44,412 @@
 #include <com/com.h>
 #include <core/core.h>
 
+#include <atomic>
+#include <list>
+#include <memory>
+#include <thread>
+#include <vector>
+
 namespace WPEFramework {
 namespace Plugin {
-    class DeviceInfoImplementation : public Exchange::IDeviceInfo, public Exchange::IConfiguration {
+    class DeviceInfoImplementation : public Exchange::IDeviceInfo, public Exchange::IConfiguration, public Exchange::IDeviceInfoExtended {
+    private:
+        class Config : public Core::JSON::Container {
+        public:
+            // How long an empty MFR or RFC answer is remembered, in seconds.
+            // "expiry" applies to every MFR type and RFC parameter, "sources"
+            // overrides it per source name, e.g. "MFR PROVISIONED_MODELNAME"
+            // or "RFC Device.DeviceInfo.SerialNumber".
+            class NegativeCacheConfig : public Core::JSON::Container {
+            public:
+                class Source : public Core::JSON::Container {
+                public:
+                    Source()
+                        : Core::JSON::Container()
+                        , Name()
+                        , Expiry(0)
+                    {
+                        Add(_T("name"), &Name);
+                        Add(_T("expiry"), &Expiry);
+                    }
+                    Source(const Source& copy)
+                        : Core::JSON::Container()
+                        , Name(copy.Name)
+                        , Expiry(copy.Expiry)
+                    {
+                        Add(_T("name"), &Name);
+                        Add(_T("expiry"), &Expiry);
+                    }
+                    Source& operator=(const Source& rhs)
+                    {
+                        Name = rhs.Name;
+                        Expiry = rhs.Expiry;
+                        return (*this);
+                    }
+                    ~Source() override = default;
+
+                public:
+                    Core::JSON::String Name;
+                    Core::JSON::DecUInt32 Expiry;
+                };
+
+            public:
+                NegativeCacheConfig(const NegativeCacheConfig&) = delete;
+                NegativeCacheConfig& operator=(const NegativeCacheConfig&) = delete;
+
+                NegativeCacheConfig()
+                    : Core::JSON::Container()
+                    , Expiry(0)
+                    , Sources()
+                {
+                    Add(_T("expiry"), &Expiry);
+                    Add(_T("sources"), &Sources);
+                }
+                ~NegativeCacheConfig() override = default;
+
+            public:
+                Core::JSON::DecUInt32 Expiry;
+                Core::JSON::ArrayType<Source> Sources;
+            };
+
+            // Protection of the IARM calls to the MFR daemon. "timeout" (ms) bounds
+            // each call, 0 keeps the IARM default. After "failurethreshold" failed
+            // or late calls in a row MFR reads fail fast for "opentime" ms, then a
+            // single probe decides whether to resume; a threshold of 0 disables it.
+            class MFRConfig : public Core::JSON::Container {
+            public:
+                MFRConfig(const MFRConfig&) = delete;
+                MFRConfig& operator=(const MFRConfig&) = delete;
+
+                MFRConfig()
+                    : Core::JSON::Container()
+                    , Timeout(0)
+                    , FailureThreshold(0)
+                    , OpenTime(30000)
+                {
+                    Add(_T("timeout"), &Timeout);
+                    Add(_T("failurethreshold"), &FailureThreshold);
+                    Add(_T("opentime"), &OpenTime);
+                }
+                ~MFRConfig() override = default;
+
+            public:
+                Core::JSON::DecUInt32 Timeout;
+                Core::JSON::DecUInt32 FailureThreshold;
+                Core::JSON::DecUInt32 OpenTime;
+            };
+
+            // Where eth_mac, estb_mac, wifi_mac and estb_ip come from: "script" runs
+            // getDeviceDetails.sh per request, "coprocess" sends the requests to one
+            // long-lived helper running it, "native" reads the interfaces directly,
+            // "netlink" answers them and the addresses from a live RTNETLINK model and
+            // reports EstbIpChanged. The "script" member names the getDeviceDetails.sh
+            // to run; left empty, /lib/rdk/getDeviceDetails.sh is used. "ethernet",
+            // "estb" and "wifi" name the interface of each role; left empty, the
+            // <ROLE>_INTERFACE entry of device.properties is used. "timeout" (ms)
+            // bounds every script run and helper request; a script exiting non-zero is
+            // a failure. The helper is restarted at most "restarts" times per
+            // "restartwindow" (ms) before falling back to running the script per
+            // request.
+            class DeviceDetailsConfig : public Core::JSON::Container {
+            public:
+                DeviceDetailsConfig(const DeviceDetailsConfig&) = delete;
+                DeviceDetailsConfig& operator=(const DeviceDetailsConfig&) = delete;
+
+                DeviceDetailsConfig()
+                    : Core::JSON::Container()
+                    , Mode(_T("script"))
+                    , Script()
+                    , Ethernet()
+                    , Estb()
+                    , Wifi()
+                    , Timeout(5000)
+                    , Restarts(5)
+                    , RestartWindow(60000)
+                {
+                    Add(_T("mode"), &Mode);
+                    Add(_T("script"), &Script);
+                    Add(_T("ethernet"), &Ethernet);
+                    Add(_T("estb"), &Estb);
+                    Add(_T("wifi"), &Wifi);
+                    Add(_T("timeout"), &Timeout);
+                    Add(_T("restarts"), &Restarts);
+                    Add(_T("restartwindow"), &RestartWindow);
+                }
+                ~DeviceDetailsConfig() override = default;
+
+            public:
+                Core::JSON::String Mode;
+                Core::JSON::String Script;
+                Core::JSON::String Ethernet;
+                Core::JSON::String Estb;
+                Core::JSON::String Wifi;
+                Core::JSON::DecUInt32 Timeout;
+                Core::JSON::DecUInt8 Restarts;
+                Core::JSON::DecUInt32 RestartWindow;
+            };
+
+            // Interfaces Addresses() reports, selected before the iterator is
+            // built: "interfaces" is a name glob such as "eth*", "up" keeps the
+            // interfaces that are up, "hasaddress" the ones with an address and
+            // "family" ("ipv4" or "ipv6") the kind of address reported. All of
+            // them are off by default.
+            class AddressesConfig : public Core::JSON::Container {
+            public:
+                AddressesConfig(const AddressesConfig&) = delete;
+                AddressesConfig& operator=(const AddressesConfig&) = delete;
+
+                AddressesConfig()
+                    : Core::JSON::Container()
+                    , Interfaces()
+                    , Up(false)
+                    , HasAddress(false)
+                    , Family()
+                {
+                    Add(_T("interfaces"), &Interfaces);
+                    Add(_T("up"), &Up);
+                    Add(_T("hasaddress"), &HasAddress);
+                    Add(_T("family"), &Family);
+                }
+                ~AddressesConfig() override = default;
+
+            public:
+                Core::JSON::String Interfaces;
+                Core::JSON::Boolean Up;
+                Core::JSON::Boolean HasAddress;
+                Core::JSON::String Family;
+            };
+
+            class SystemInfoConfig : public Core::JSON::Container {
+            public:
+                SystemInfoConfig(const SystemInfoConfig&) = delete;
+                SystemInfoConfig& operator=(const SystemInfoConfig&) = delete;
+
+                SystemInfoConfig()
+                    : Core::JSON::Container()
+                    , Interval(1000)
+                    , History(0)
+                {
+                    Add(_T("interval"), &Interval);
+                    Add(_T("history"), &History);
+                }
+                ~SystemInfoConfig() override = default;
+
+            public:
+                // ms between two background samples of SystemInfo(), 1000 by default; 0 samples on
+                // every call, which also leaves the history and the thermal threshold without samples.
+                Core::JSON::DecUInt32 Interval;
+                // Samples kept for SystemInfoHistory(); 0 disables it.
+                Core::JSON::DecUInt32 History;
+            };
+
+            class ThermalConfig : public Core::JSON::Container {
+            public:
+                ThermalConfig(const ThermalConfig&) = delete;
+                ThermalConfig& operator=(const ThermalConfig&) = delete;
+
+                ThermalConfig()
+                    : Core::JSON::Container()
+                    , Threshold(0)
+                    , Hysteresis(2000)
+                    , ThermalClass()
+                    , CpuDevices()
+                {
+                    Add(_T("threshold"), &Threshold);
+                    Add(_T("hysteresis"), &Hysteresis);
+                    Add(_T("thermalclass"), &ThermalClass);
+                    Add(_T("cpudevices"), &CpuDevices);
+                }
+                ~ThermalConfig() override = default;
+
+            public:
+                // millidegree Celsius a zone must reach for ThermalThreshold; 0 disables the event.
+                Core::JSON::DecUInt32 Threshold;
+                // millidegree Celsius it must drop below the threshold again before it is reported as cleared.
+                Core::JSON::DecUInt32 Hysteresis;
+                // Roots in place of /sys/class/thermal/ and /sys/devices/system/cpu/; empty keeps those.
+                Core::JSON::String ThermalClass;
+                Core::JSON::String CpuDevices;
+            };
+
+            class PressureConfig : public Core::JSON::Container {
+            public:
+                PressureConfig(const PressureConfig&) = delete;
+                PressureConfig& operator=(const PressureConfig&) = delete;
+
+                PressureConfig()
+                    : Core::JSON::Container()
+                    , Memory()
+                    , Cpu()
+                    , Io()
+                {
+                    Add(_T("memory"), &Memory);
+                    Add(_T("cpu"), &Cpu);
+                    Add(_T("io"), &Io);
+                }
+                ~PressureConfig() override = default;
+
+            public:
+                // PSI triggers, e.g. "some 150000 2000000"; unprivileged
+                // processes need a window that is a multiple of 2s.
+                Core::JSON::String Memory;
+                Core::JSON::String Cpu;
+                Core::JSON::String Io;
+            };
+
+        public:
+            Config(const Config&) = delete;
+            Config& operator=(const Config&) = delete;
+
+            Config()
+                : Core::JSON::Container()
+                , IdentitySnapshot(false)
+                , NegativeCache()
+                , MFRPrefetch(0)
+                , MFR()
+                , DeviceDetails()
+                , Addresses()
+                , SystemInfo()
+                , Thermal()
+                , Pressure()
+            {
+                Add(_T("identitysnapshot"), &IdentitySnapshot);
+                Add(_T("negativecache"), &NegativeCache);
+                Add(_T("mfrprefetch"), &MFRPrefetch);
+                Add(_T("mfr"), &MFR);
+                Add(_T("devicedetails"), &DeviceDetails);
+                Add(_T("addresses"), &Addresses);
+                Add(_T("systeminfo"), &SystemInfo);
+                Add(_T("thermal"), &Thermal);
+                Add(_T("pressure"), &Pressure);
+            }
+            ~Config() override = default;
+
+        public:
+            Core::JSON::Boolean IdentitySnapshot;
+            NegativeCacheConfig NegativeCache;
+            // Number of workers fetching every MFR serialized type after Configure; 0 disables it.
+            Core::JSON::DecUInt8 MFRPrefetch;
+            MFRConfig MFR;
+            DeviceDetailsConfig DeviceDetails;
+            AddressesConfig Addresses;
+            SystemInfoConfig SystemInfo;
+            ThermalConfig Thermal;
+            PressureConfig Pressure;
+        };
+
+        // Fields resolved through a ResolutionChain, in the order of the chain table.
+        enum chain : uint8_t {
+            SERIAL_NUMBER,
+            SKU,
+            MAKE,
+            BRAND,
+            DISTRIBUTOR_ID,
+            CHAINS
+        };
+
+        // /version.txt fields FirmwareVersion() takes from one parse of the file.
+        enum version : uint8_t {
+            VERSION_IMAGENAME,
+            VERSION_SDK,
+            VERSION_MEDIARITE,
+            VERSION_YOCTO,
+            VERSION_FIELDS
+        };
+
+        // Where eth_mac, estb_mac, wifi_mac and estb_ip are read from.
+        enum details : uint8_t {
+            DETAILS_SCRIPT,
+            DETAILS_COPROCESS,
+            DETAILS_NATIVE
+        };
+
+        // Fields getDeviceDetails.sh reports together when "read" is given no field.
+        enum network : uint8_t {
+            NETWORK_ETH_MAC,
+            NETWORK_ESTB_MAC,
+            NETWORK_WIFI_MAC,
+            NETWORK_ESTB_IP,
+            NETWORK_FIELDS
+        };
+
+        // NetworkIdentity() result; a field that could not be resolved is empty.
+        struct NetworkFields {
+            string values[NETWORK_FIELDS];
+        };
+
+        // Values that do not change while the device runs. A snapshot is never
+        // modified once published; an empty member could not be resolved when
+        // the snapshot was taken and is still looked up on every call.
+        struct Identity {
+            string serialNumber;
+            string sku;
+            string make;
+            string model;
+            string socName;
+            string chipset;
+        };
+
+        class MonitorSink : public NetlinkMonitor::ICallback {
+        public:
+            MonitorSink(const MonitorSink&) = delete;
+            MonitorSink& operator=(const MonitorSink&) = delete;
+
+            explicit MonitorSink(DeviceInfoImplementation& parent)
+                : _parent(parent)
+            {
+            }
+            ~MonitorSink() override = default;
+
+            void AddressChanged(const string& interfaceName) override
+            {
+                _parent.AddressChanged(interfaceName);
+            }
+
+        private:
+            DeviceInfoImplementation& _parent;
+        };
+
+        class SystemInfoSource : public SystemInfoSampler::ICallback {
+        public:
+            SystemInfoSource(const SystemInfoSource&) = delete;
+            SystemInfoSource& operator=(const SystemInfoSource&) = delete;
+
+            explicit SystemInfoSource(DeviceInfoImplementation& parent)
+                : _parent(parent)
+            {
+            }
+            ~SystemInfoSource() override = default;
+
+            void Sample(SystemInfos& info) const override
+            {
+                _parent.Sample(info);
+            }
+
+        private:
+            DeviceInfoImplementation& _parent;
+        };
+
+        class PressureSink : public PressureMonitor::ICallback {
+        public:
+            PressureSink(const PressureSink&) = delete;
+            PressureSink& operator=(const PressureSink&) = delete;
+
+            explicit PressureSink(DeviceInfoImplementation& parent)
+                : _parent(parent)
+            {
+            }
+            ~PressureSink() override = default;
+
+            void PressureStall(const PressureMonitor::resource which) override
+            {
+                _parent.PressureStall(which);
+            }
+
+        private:
+            DeviceInfoImplementation& _parent;
+        };
+
     public:
         // We do not allow this plugin to be copied !!
         DeviceInfoImplementation();
@@ -42,6 +461,7 @@ namespace Plugin {
         BEGIN_INTERFACE_MAP(DeviceInfoImplementation)
         INTERFACE_ENTRY(Exchange::IDeviceInfo)
         INTERFACE_ENTRY(Exchange::IConfiguration)
+        INTERFACE_ENTRY(Exchange::IDeviceInfoExtended)
         END_INTERFACE_MAP
 
     public:
@@ -68,8 +488,111 @@ namespace Plugin {
         // IConfiguration interface
         uint32_t Configure(PluginHost::IShell* service) override;
 
+        // IDeviceInfoExtended interface
+        Core::hresult Register(Exchange::IDeviceInfoExtended::INotification* notification) override;
+        Core::hresult Unregister(Exchange::IDeviceInfoExtended::INotification* notification) override;
+        Core::hresult RefreshIdentity() override;
+        Core::hresult SourceStatistics(string& statistics) const override;
+        Core::hresult NetworkAddresses(const string& interfaces, const bool up, const bool hasAddress, const string& family, string& addresses) const override;
+        Core::hresult SystemInfoHistory(const uint32_t window, string& samples) const override;
+        Core::hresult SystemInfoFields(const string& fields, string& info) const override;
+        Core::hresult ThermalInfo(string& info) const override;
+        Core::hresult MemoryPressure(const uint32_t host, string& pressure) const override;
+        Core::hresult NetworkIdentity(string& ethMac, string& estbMac, string& wifiMac, string& estbIp) const override;
+
+        // Keeps the interface model, and in "netlink" device details mode the
+        // network fields, from a socket that answers like RTNETLINK instead;
+        // see NetlinkMonitor::Start().
+        uint32_t Netlink(const int descriptor);
+
+    private:
+        void Statistics(std::list<ValueSource::Statistics>& statistics) const;
+        void Prefetch(const uint8_t workers);
+        void WaitForPrefetch();
+        void TakeSnapshot();
+        bool FromIdentity(string Identity::*field, string& value) const;
+        uint32_t Lookup(string Identity::*field, const TCHAR key[], uint32_t (DeviceInfoImplementation::*resolve)(string&) const, string& value) const;
+
+        // Backend reads behind the getters; concurrent callers of a getter share one of them.
+        uint32_t ResolveSerialNumber(string& serialNumber) const;
+        uint32_t ResolveSku(string& sku) const;
+        uint32_t ResolveMake(string& make) const;
+        uint32_t ResolveModel(string& model) const;
+        uint32_t ResolveSocName(string& socName) const;
+        uint32_t ResolveChipset(string& chipset) const;
+        uint32_t ResolveDeviceType(DeviceTypeInfos& deviceTypeInfos) const;
+        uint32_t ResolveReleaseVersion(DeviceReleaseVer& deviceReleaseVer) const;
+        uint32_t ResolveFirmwareVersion(FirmwareversionInfo& firmwareVersionInfo) const;
+        uint32_t ResolveSystemInfo(SystemInfos& systemInfo) const;
+        uint32_t LatestSystemInfo(SystemInfos& systemInfo, const bool identity) const;
+        void SampleSystemInfo(SystemInfos& systemInfo, const ProcfsReader::Figures& figures, const bool identity) const;
+        void Sample(SystemInfos& systemInfo);
+        void SampleThermal();
+        void PressureStall(const PressureMonitor::resource which);
+        uint32_t ResolveAddresses(std::list<AddressesInfo>& addresses) const;
+        uint32_t Links(std::list<NetlinkMonitor::Link>& links) const;
+        void MonitorStarted();
+        uint32_t ResolveEthMac(EthernetMac& ethernetMac) const;
+        uint32_t ResolveEstbMac(StbMac& stbMac) const;
+        uint32_t ResolveWifiMac(WiFiMac& wiFiMac) const;
+        uint32_t ResolveEstbIp(StbIp& stbIp) const;
+        uint32_t ResolveAudioPorts(std::list<string>& audioPorts) const;
+        uint32_t ResolveNetworkIdentity(NetworkFields& fields) const;
+        void AddressChanged(const string& interfaceName);
+        uint32_t DeviceDetail(const TCHAR field[], string& value) const;
+
     private:
         PluginHost::IShell* _service;
+        FileCache _files;
+        DevicePropertiesStore _deviceProperties;
+        FileKeySet _versionFile;
+        Core::CriticalSection _adminLock;
+        bool _identityEnabled;
+        std::atomic<const Identity*> _identity;
+        // Published snapshots may still be read lock-free, so replaced ones are
+        // only released with the implementation.
+        std::vector<const Identity*> _retired;
+        std::vector<std::unique_ptr<ValueSource>> _sources;
+        std::vector<std::unique_ptr<ResolutionChain>> _chains;
+        std::vector<std::thread> _prefetchers;
+        std::atomic<uint32_t> _prefetchIndex;
+        CircuitBreaker _mfrBreaker;
+        std::atomic<uint32_t> _mfrTimeout;
+        NetlinkMonitor _monitor;
+        MonitorSink _monitorSink;
+        NetworkInterfaces _network;
+        // Sinks for EstbIpChanged, ThermalThreshold and PressureStall, and the ESTB IP last reported to them.
+        Core::CriticalSection _notificationLock;
+        std::list<Exchange::IDeviceInfoExtended::INotification*> _notifications;
+        string _estbIp;
+        std::atomic<details> _details;
+        // getDeviceDetails.sh, set once by Configure().
+        string _script;
+        mutable DeviceDetailsCoprocess _coprocess;
+        ScriptExecutor _executor;
+        // Addresses() result for the monitor generation it was built from; 0 is none.
+        mutable Core::CriticalSection _addressesLock;
+        mutable std::list<AddressesInfo> _addresses;
+        mutable uint32_t _addressesGeneration;
+        AddressFilter _addressFilter;
+        ProcfsReader _procfs;
+        // CPU load baselines of the on-demand samples and of the sampler.
+        mutable ProcfsReader::CpuBaseline _cpu;
+        ProcfsReader::CpuBaseline _samplerCpu;
+        // Load and memory samples of the last "history" intervals, fed by the sampler.
+        Plugin::SystemInfoHistory _history;
+        ThermalReader _thermalReader;
+        // Latest thermal sample of the sampler; empty while it does not run.
+        mutable Core::CriticalSection _thermalLock;
+        ThermalReader::Sample _thermal;
+        ThermalReader::Sample _thermalSpare;
+        uint64_t _thermalSampled;
+        ThermalThreshold _thermalThreshold;
+        SystemInfoSource _systemInfoSource;
+        SystemInfoSampler _sampler;
+        PressureMonitor _pressureMonitor;
+        PressureSink _pressureSink;
+        mutable SingleFlight _singleFlight;
     };
 }
 }
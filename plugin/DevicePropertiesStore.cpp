@@ -0,0 +1,84 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2026 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+#include "DevicePropertiesStore.h"
+#include "FileKey.h"
+
+namespace WPEFramework {
+namespace Plugin {
+
+    DevicePropertiesStore::DevicePropertiesStore(const FileCache& files, const string& fileName)
+        : _files(files)
+        , _fileName(fileName)
+        , _adminLock()
+        , _properties()
+        , _generation(0)
+    {
+    }
+
+    uint32_t DevicePropertiesStore::Get(const string& key, string& value) const
+    {
+        uint32_t result = Core::ERROR_GENERAL;
+
+        _adminLock.Lock();
+
+        const uint32_t generation = _files.Generation(_fileName);
+        if (generation != _generation) {
+            Load();
+            _generation = generation;
+        }
+
+        auto it = _properties.find(key);
+        if (it != _properties.end()) {
+            value = it->second;
+            result = Core::ERROR_NONE;
+        }
+
+        _adminLock.Unlock();
+
+        return result;
+    }
+
+    void DevicePropertiesStore::Load() const
+    {
+        _properties.clear();
+
+        string content;
+        if (_files.Content(_fileName, content) == Core::ERROR_NONE) {
+            const char* line = content.c_str();
+            const char* const end = line + content.length();
+            string key;
+            string value;
+
+            while (line < end) {
+                const char* next = static_cast<const char*>(memchr(line, '\n', end - line));
+                const size_t length = (next != nullptr) ? static_cast<size_t>(next - line) : static_cast<size_t>(end - line);
+
+                // First valid definition wins, like the line-by-line search it replaces.
+                if (FileKey::Assignment(line, length, key, value) == true) {
+                    _properties.emplace(key, value);
+                }
+
+                line += length + 1;
+            }
+        }
+    }
+
+} // namespace Plugin
+} // namespace WPEFramework
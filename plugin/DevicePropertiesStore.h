@@ -0,0 +1,58 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2026 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+#pragma once
+
+#include "Module.h"
+#include "FileCache.h"
+
+#include <unordered_map>
+
+namespace WPEFramework {
+namespace Plugin {
+
+    // Flat KEY=value index over a properties file such as /etc/device.properties.
+    // The file is parsed once and re-parsed only when the FileCache reports a
+    // new generation for it, so lookups are a generation check and a hash probe.
+    class DevicePropertiesStore {
+    public:
+        DevicePropertiesStore(const DevicePropertiesStore&) = delete;
+        DevicePropertiesStore& operator=(const DevicePropertiesStore&) = delete;
+
+        DevicePropertiesStore(const FileCache& files, const string& fileName);
+        ~DevicePropertiesStore() = default;
+
+    public:
+        // Same contract as matching "^KEY\s*=\s*"?([^"\n]+)"?\s*$" against each
+        // line and taking the first hit: ERROR_NONE and the value, or ERROR_GENERAL.
+        uint32_t Get(const string& key, string& value) const;
+
+    private:
+        void Load() const;
+
+    private:
+        const FileCache& _files;
+        const string _fileName;
+        mutable Core::CriticalSection _adminLock;
+        mutable std::unordered_map<string, string> _properties;
+        mutable uint32_t _generation;
+    };
+
+} // namespace Plugin
+} // namespace WPEFramework
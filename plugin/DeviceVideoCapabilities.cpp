@@ -32,6 +32,7 @@ namespace Plugin {
     SERVICE_REGISTRATION(DeviceVideoCapabilities, 1, 0);
 
     DeviceVideoCapabilities::DeviceVideoCapabilities()
+        : _singleFlight()
     {
         Utils::IARM::init();
 
@@ -47,10 +48,22 @@ namespace Plugin {
 
     Core::hresult DeviceVideoCapabilities::SupportedVideoDisplays(RPC::IStringIterator*& supportedVideoDisplays, bool& success) const
     {
-        uint32_t result = Core::ERROR_NONE;
-
         std::list<string> list;
 
+        const uint32_t result = _singleFlight.Do(_T("supportedvideodisplays"), list, [this](std::list<string>& displays) { return (QueryVideoDisplays(displays)); });
+
+        if (result == Core::ERROR_NONE) {
+            supportedVideoDisplays = (Core::Service<RPC::StringIterator>::Create<RPC::IStringIterator>(list));
+            success = true;
+        }
+
+        return result;
+    }
+
+    uint32_t DeviceVideoCapabilities::QueryVideoDisplays(std::list<string>& list) const
+    {
+        uint32_t result = Core::ERROR_NONE;
+
         try {
             const auto& vPorts = device::Host::getInstance().getVideoOutputPorts();
             for (size_t i = 0; i < vPorts.size(); i++) {
@@ -82,15 +95,15 @@ namespace Plugin {
             result = Core::ERROR_GENERAL;
         }
 
-        if (result == Core::ERROR_NONE) {
-            supportedVideoDisplays = (Core::Service<RPC::StringIterator>::Create<RPC::IStringIterator>(list));
-            success = true;
-        }
-
         return result;
     }
 
     Core::hresult DeviceVideoCapabilities::HostEDID(HostEdid& hostEdid) const
+    {
+        return (_singleFlight.Do(_T("hostedid"), hostEdid, [this](HostEdid& result) { return (QueryHostEDID(result)); }));
+    }
+
+    uint32_t DeviceVideoCapabilities::QueryHostEDID(HostEdid& hostEdid) const
     {
         uint32_t result = Core::ERROR_NONE;
 
@@ -125,6 +138,11 @@ namespace Plugin {
     }
 
     Core::hresult DeviceVideoCapabilities::DefaultResolution(const string& videoDisplay, DefaultResln& defaultResln) const
+    {
+        return (_singleFlight.Do(_T("defaultresolution@") + videoDisplay, defaultResln, [this, &videoDisplay](DefaultResln& result) { return (QueryDefaultResolution(videoDisplay, result)); }));
+    }
+
+    uint32_t DeviceVideoCapabilities::QueryDefaultResolution(const string& videoDisplay, DefaultResln& defaultResln) const
     {
         uint32_t result = Core::ERROR_NONE;
 
@@ -147,10 +165,22 @@ namespace Plugin {
 
     Core::hresult DeviceVideoCapabilities::SupportedResolutions(const string& videoDisplay, RPC::IStringIterator*& supportedResolutions, bool& success) const
     {
-        uint32_t result = Core::ERROR_NONE;
-
         std::list<string> list;
 
+        const uint32_t result = _singleFlight.Do(_T("supportedresolutions@") + videoDisplay, list, [this, &videoDisplay](std::list<string>& resolutions) { return (QueryResolutions(videoDisplay, resolutions)); });
+
+        if (result == Core::ERROR_NONE) {
+            supportedResolutions = (Core::Service<RPC::StringIterator>::Create<RPC::IStringIterator>(list));
+            success = true;
+        }
+
+        return result;
+    }
+
+    uint32_t DeviceVideoCapabilities::QueryResolutions(const string& videoDisplay, std::list<string>& list) const
+    {
+        uint32_t result = Core::ERROR_NONE;
+
         try {
             auto strVideoPort = videoDisplay.empty() ? device::Host::getInstance().getDefaultVideoPortName() : videoDisplay;
             auto& vPort = device::Host::getInstance().getVideoOutputPort(strVideoPort);
@@ -168,15 +198,15 @@ namespace Plugin {
             result = Core::ERROR_GENERAL;
         }
 
-        if (result == Core::ERROR_NONE) {
-            supportedResolutions = (Core::Service<RPC::StringIterator>::Create<RPC::IStringIterator>(list));
-            success = true;
-        }
-
         return result;
     }
 
     Core::hresult DeviceVideoCapabilities::SupportedHdcp(const string& videoDisplay, SupportedHDCPVer& supportedHDCPVer) const
+    {
+        return (_singleFlight.Do(_T("supportedhdcp@") + videoDisplay, supportedHDCPVer, [this, &videoDisplay](SupportedHDCPVer& result) { return (QueryHdcp(videoDisplay, result)); }));
+    }
+
+    uint32_t DeviceVideoCapabilities::QueryHdcp(const string& videoDisplay, SupportedHDCPVer& supportedHDCPVer) const
     {
         uint32_t result = Core::ERROR_NONE;
 
@@ -20,6 +20,9 @@
 #pragma once
 
 #include "Module.h"
+#include "SingleFlight.h"
+
+#include <list>
 #include <interfaces/IDeviceInfo.h>
 
 namespace WPEFramework {
@@ -43,6 +46,17 @@ namespace Plugin {
         Core::hresult DefaultResolution(const string& videoDisplay, DefaultResln& defaultResln) const override;
         Core::hresult SupportedResolutions(const string& videoDisplay, RPC::IStringIterator*& supportedResolutions, bool& success) const override;
         Core::hresult SupportedHdcp(const string& videoDisplay, SupportedHDCPVer& supportedHDCPVer) const override;
+
+    private:
+        // DS queries behind the getters; concurrent callers for the same display share one of them.
+        uint32_t QueryVideoDisplays(std::list<string>& list) const;
+        uint32_t QueryHostEDID(HostEdid& hostEdid) const;
+        uint32_t QueryDefaultResolution(const string& videoDisplay, DefaultResln& defaultResln) const;
+        uint32_t QueryResolutions(const string& videoDisplay, std::list<string>& list) const;
+        uint32_t QueryHdcp(const string& videoDisplay, SupportedHDCPVer& supportedHDCPVer) const;
+
+    private:
+        mutable SingleFlight _singleFlight;
     };
 }
 }
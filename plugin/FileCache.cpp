@@ -0,0 +1,175 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2026 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+#include "FileCache.h"
+
+#include <sys/inotify.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <fstream>
+#include <iterator>
+
+namespace WPEFramework {
+namespace Plugin {
+    namespace {
+
+        // One-shot: any of these consumes the watch, Lookup() arms the next one.
+        constexpr uint32_t WatchMask = IN_MODIFY | IN_CLOSE_WRITE | IN_ATTRIB | IN_DELETE_SELF | IN_MOVE_SELF | IN_ONESHOT;
+    }
+
+    FileCache::FileCache()
+        : _adminLock()
+        , _files()
+        , _inotify(inotify_init1(IN_NONBLOCK | IN_CLOEXEC))
+    {
+        if (_inotify < 0) {
+            TRACE(Trace::Error, (_T("inotify_init1 failed [%d], files will be read on every request"), errno));
+        }
+    }
+
+    FileCache::~FileCache()
+    {
+        if (_inotify >= 0) {
+            // Closing the descriptor drops every watch with it.
+            close(_inotify);
+            _inotify = -1;
+        }
+    }
+
+    uint32_t FileCache::Content(const string& fileName, string& content) const
+    {
+        uint32_t result = Core::ERROR_GENERAL;
+
+        _adminLock.Lock();
+
+        Drain();
+
+        Entry& entry = Lookup(fileName);
+
+        if (entry.loaded != entry.generation) {
+            std::ifstream file(fileName);
+            entry.exists = static_cast<bool>(file);
+            if (entry.exists == true) {
+                entry.content.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+            } else {
+                entry.content.clear();
+            }
+            entry.loaded = entry.generation;
+        }
+
+        if (entry.exists == true) {
+            content = entry.content;
+            result = Core::ERROR_NONE;
+        }
+
+        _adminLock.Unlock();
+
+        return result;
+    }
+
+    uint32_t FileCache::Generation(const string& fileName) const
+    {
+        _adminLock.Lock();
+
+        Drain();
+
+        const uint32_t result = Lookup(fileName).generation;
+
+        _adminLock.Unlock();
+
+        return result;
+    }
+
+    FileCache::Entry& FileCache::Lookup(const string& fileName) const
+    {
+        auto it = _files.find(fileName);
+
+        if (it == _files.end()) {
+            Entry entry;
+            entry.watch = -1;
+            entry.generation = 1;
+            entry.loaded = 0;
+            entry.exists = false;
+
+            it = _files.emplace(fileName, std::move(entry)).first;
+        }
+
+        if (it->second.watch < 0) {
+            // The watch must be in place before the file is read, or a change
+            // landing between the read and the watch would go unnoticed.
+            Watch(fileName, it->second);
+        }
+
+        return it->second;
+    }
+
+    void FileCache::Watch(const string& fileName, Entry& entry) const
+    {
+        if (_inotify >= 0) {
+            const int watch = inotify_add_watch(_inotify, fileName.c_str(), WatchMask);
+            if (watch >= 0) {
+                entry.watch = watch;
+            }
+        }
+
+        // Whatever was cached predates the watch (or there is no watch at all).
+        entry.generation++;
+    }
+
+    void FileCache::Drain() const
+    {
+        if (_inotify < 0) {
+            return;
+        }
+
+        alignas(struct inotify_event) char buffer[4096];
+        ssize_t length;
+
+        while ((length = read(_inotify, buffer, sizeof(buffer))) > 0) {
+            const char* position = buffer;
+
+            while (position < (buffer + length)) {
+                const struct inotify_event* event = reinterpret_cast<const struct inotify_event*>(position);
+
+                if ((event->mask & IN_Q_OVERFLOW) != 0) {
+                    // Which watches fired is lost; drop them all and re-arm on the next lookups.
+                    for (auto& file : _files) {
+                        if (file.second.watch >= 0) {
+                            inotify_rm_watch(_inotify, file.second.watch);
+                            file.second.watch = -1;
+                        }
+                        file.second.generation++;
+                    }
+                } else if ((event->mask & IN_IGNORED) == 0) {
+                    for (auto& file : _files) {
+                        if (file.second.watch == event->wd) {
+                            file.second.watch = -1;
+                            file.second.generation++;
+                        }
+                    }
+                }
+
+                position += sizeof(struct inotify_event) + event->len;
+            }
+        }
+    }
+
+} // namespace Plugin
+} // namespace WPEFramework
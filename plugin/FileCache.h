@@ -0,0 +1,75 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2026 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+#pragma once
+
+#include "Module.h"
+
+#include <map>
+
+namespace WPEFramework {
+namespace Plugin {
+
+    // In-memory copy of small configuration files, kept coherent with inotify.
+    // Each file itself is watched with a one-shot watch, so busy directories
+    // such as /tmp do not flood the queue: the first modification, attribute
+    // change, removal or rename consumes the watch and the next lookup arms a
+    // new one before reading the file again. Pending events are drained
+    // (non-blocking) before every lookup, so a value rewritten on disk is seen
+    // by the very next request while unchanged files are served from memory.
+    class FileCache {
+    private:
+        struct Entry {
+            int watch;
+            uint32_t generation;
+            uint32_t loaded;
+            bool exists;
+            string content;
+        };
+
+    public:
+        FileCache(const FileCache&) = delete;
+        FileCache& operator=(const FileCache&) = delete;
+
+        FileCache();
+        ~FileCache();
+
+    public:
+        // ERROR_NONE and the file contents, or ERROR_GENERAL if it can not be read.
+        uint32_t Content(const string& fileName, string& content) const;
+
+        // Changes whenever the file is modified, replaced, created or removed.
+        // Files that can not be watched, including files that do not exist
+        // yet, get a new value on every call, so anything derived from them
+        // is never reused.
+        uint32_t Generation(const string& fileName) const;
+
+    private:
+        Entry& Lookup(const string& fileName) const;
+        void Watch(const string& fileName, Entry& entry) const;
+        void Drain() const;
+
+    private:
+        mutable Core::CriticalSection _adminLock;
+        mutable std::map<string, Entry> _files;
+        int _inotify;
+    };
+
+} // namespace Plugin
+} // namespace WPEFramework
@@ -0,0 +1,220 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2026 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+#include "FileKey.h"
+
+namespace WPEFramework {
+namespace Plugin {
+    namespace {
+
+        inline bool IsSpace(const char c)
+        {
+            return (c == ' ') || (c == '\t') || (c == '\n') || (c == '\v') || (c == '\f') || (c == '\r');
+        }
+
+        // Equivalent of \s*=\s*"?([^"\n]+)"?\s*$ applied to the text after the key,
+        // including the std::regex backtracking outcome for blank-only values.
+        bool AssignedValue(const char text[], const size_t length, string& value)
+        {
+            size_t equals = 0;
+            while ((equals < length) && IsSpace(text[equals])) {
+                equals++;
+            }
+            if ((equals == length) || (text[equals] != '=')) {
+                return false;
+            }
+
+            const char* assigned = text + equals + 1;
+            const size_t remaining = length - equals - 1;
+
+            size_t blanks = 0;
+            while ((blanks < remaining) && IsSpace(assigned[blanks])) {
+                blanks++;
+            }
+
+            size_t begin = blanks;
+            if ((begin < remaining) && (assigned[begin] == '"')) {
+                begin++;
+            }
+
+            size_t end = begin;
+            while ((end < remaining) && (assigned[end] != '"') && (assigned[end] != '\n')) {
+                end++;
+            }
+
+            if (end == begin) {
+                if (blanks == 0) {
+                    return false;
+                }
+                begin = blanks - 1;
+                end = blanks;
+            }
+
+            size_t tail = end;
+            if ((tail < remaining) && (assigned[tail] == '"')) {
+                tail++;
+            }
+            while ((tail < remaining) && IsSpace(assigned[tail])) {
+                tail++;
+            }
+
+            if (tail != remaining) {
+                return false;
+            }
+
+            value.assign(assigned + begin, end - begin);
+            return true;
+        }
+    }
+
+    bool FileKey::Match(const char line[], const size_t lineLength, string& value) const
+    {
+        bool result = false;
+
+        switch (type) {
+        case LINE:
+            if (lineLength > 0) {
+                value.assign(line, lineLength);
+                result = true;
+            }
+            break;
+        case PREFIXED:
+            if ((lineLength > length) && (strncmp(line, key, length) == 0)) {
+                value.assign(line + length, lineLength - length);
+                result = true;
+            }
+            break;
+        case ASSIGNMENT:
+            if ((lineLength > length) && (strncmp(line, key, length) == 0)) {
+                result = AssignedValue(line + length, lineLength - length, value);
+            }
+            break;
+        }
+
+        return result;
+    }
+
+    uint32_t FileKey::Find(const string& content, string& value) const
+    {
+        const FileKey* const keys[] = { this };
+
+        return (Find(content, 1, keys, &value) != 0) ? Core::ERROR_NONE : Core::ERROR_GENERAL;
+    }
+
+    /* static */ uint32_t FileKey::Find(const string& content, const size_t count, const FileKey* const keys[], string values[])
+    {
+        ASSERT(count <= 32);
+
+        const uint32_t all = (count >= 32) ? ~0u : ((1u << count) - 1);
+        uint32_t found = 0;
+
+        const char* line = content.c_str();
+        const char* const end = line + content.length();
+
+        while ((line < end) && (found != all)) {
+            const char* next = static_cast<const char*>(memchr(line, '\n', end - line));
+            const size_t lineLength = (next != nullptr) ? static_cast<size_t>(next - line) : static_cast<size_t>(end - line);
+
+            for (size_t index = 0; index < count; index++) {
+                if (((found & (1u << index)) == 0) && (keys[index]->Match(line, lineLength, values[index]) == true)) {
+                    found |= (1u << index);
+                }
+            }
+
+            line += lineLength + 1;
+        }
+
+        return found;
+    }
+
+    /* static */ bool FileKey::Assignment(const char line[], const size_t lineLength, string& name, string& value)
+    {
+        size_t nameLength = 0;
+        while ((nameLength < lineLength) && (line[nameLength] != '=') && !IsSpace(line[nameLength])) {
+            nameLength++;
+        }
+
+        if ((nameLength == 0) || (AssignedValue(line + nameLength, lineLength - nameLength, value) == false)) {
+            return false;
+        }
+
+        name.assign(line, nameLength);
+        return true;
+    }
+
+    FileKeySet::FileKeySet(const FileCache& files, std::initializer_list<const FileKey*> keys)
+        : _files(files)
+        , _keys(keys)
+        , _adminLock()
+        , _values(keys.size())
+        , _found(0)
+        , _generation(0)
+    {
+        ASSERT(_keys.size() <= 32);
+    }
+
+    uint32_t FileKeySet::Get(const FileKey& key, string& value) const
+    {
+        const FileKey* const keys[] = { &key };
+
+        return (Get(1, keys, &value) != 0) ? Core::ERROR_NONE : Core::ERROR_GENERAL;
+    }
+
+    uint32_t FileKeySet::Get(const size_t count, const FileKey* const keys[], string values[]) const
+    {
+        uint32_t found = 0;
+
+        _adminLock.Lock();
+
+        Refresh();
+
+        for (size_t index = 0; index < count; index++) {
+            for (size_t slot = 0; slot < _keys.size(); slot++) {
+                if (_keys[slot] == keys[index]) {
+                    if ((_found & (1u << slot)) != 0) {
+                        values[index] = _values[slot];
+                        found |= (1u << index);
+                    }
+                    break;
+                }
+            }
+        }
+
+        _adminLock.Unlock();
+
+        return found;
+    }
+
+    void FileKeySet::Refresh() const
+    {
+        ASSERT(_keys.empty() == false);
+
+        const uint32_t generation = _files.Generation(_keys.front()->file);
+
+        if (generation != _generation) {
+            string content;
+            _found = (_files.Content(_keys.front()->file, content) == Core::ERROR_NONE)
+                ? FileKey::Find(content, _keys.size(), _keys.data(), _values.data())
+                : 0;
+            _generation = generation;
+        }
+    }
+
+} // namespace Plugin
+} // namespace WPEFramework
@@ -0,0 +1,101 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2026 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+#pragma once
+
+#include "Module.h"
+#include "FileCache.h"
+
+#include <initializer_list>
+#include <vector>
+
+namespace WPEFramework {
+namespace Plugin {
+
+    // Compile-time description of a value stored in a text file, matched by
+    // hand instead of through std::regex. Each format reproduces the regex
+    // it replaces, applied to every line until the first one that matches.
+    struct FileKey {
+        enum format : uint8_t {
+            LINE, // ^([^\n]+)$
+            PREFIXED, // ^<key>([^\n]+)$
+            ASSIGNMENT // ^<key>\s*=\s*"?([^"\n]+)"?\s*$
+        };
+
+        constexpr FileKey(const TCHAR fileName[], const TCHAR keyName[], const format keyFormat)
+            : file(fileName)
+            , key(keyName)
+            , length(Length(keyName))
+            , type(keyFormat)
+        {
+        }
+
+        bool Match(const char line[], const size_t lineLength, string& value) const;
+        uint32_t Find(const string& content, string& value) const;
+
+        // Looks up several keys in one pass over the content, stopping as soon as
+        // all of them matched. Bit i of the result is set when keys[i] was found.
+        static uint32_t Find(const string& content, const size_t count, const FileKey* const keys[], string values[]);
+
+        // Splits a KEY=value line using the ASSIGNMENT rules; used to index whole files.
+        static bool Assignment(const char line[], const size_t lineLength, string& name, string& value);
+
+        const TCHAR* file;
+        const TCHAR* key;
+        size_t length;
+        format type;
+
+    private:
+        static constexpr size_t Length(const TCHAR text[])
+        {
+            return (*text == '\0') ? 0 : (1 + Length(text + 1));
+        }
+    };
+
+    // Values of a fixed set of keys from one file (all keys must name the same
+    // file). They are extracted in a single pass and shared by every reader
+    // until the FileCache reports a new generation for the file.
+    class FileKeySet {
+    public:
+        FileKeySet(const FileKeySet&) = delete;
+        FileKeySet& operator=(const FileKeySet&) = delete;
+
+        FileKeySet(const FileCache& files, std::initializer_list<const FileKey*> keys);
+        ~FileKeySet() = default;
+
+    public:
+        uint32_t Get(const FileKey& key, string& value) const;
+
+        // Consistent read of several keys from the same parse; returns the found mask.
+        uint32_t Get(const size_t count, const FileKey* const keys[], string values[]) const;
+
+    private:
+        void Refresh() const;
+
+    private:
+        const FileCache& _files;
+        const std::vector<const FileKey*> _keys;
+        mutable Core::CriticalSection _adminLock;
+        mutable std::vector<string> _values;
+        mutable uint32_t _found;
+        mutable uint32_t _generation;
+    };
+
+} // namespace Plugin
+} // namespace WPEFramework
@@ -0,0 +1,110 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2026 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+#pragma once
+
+#include "Module.h"
+
+namespace WPEFramework {
+namespace Exchange {
+
+    enum {
+        ID_DEVICE_INFO_EXTENDED = RPC::IDS::ID_EXTERNAL_CC_INTERFACE_OFFSET + 0x0D10,
+        ID_DEVICE_INFO_EXTENDED_NOTIFICATION = ID_DEVICE_INFO_EXTENDED + 1
+    };
+
+    // What DeviceInfoImplementation offers beyond IDeviceInfo, which is owned
+    // by the external interfaces repository. Queries answer with the JSON
+    // document the plugin returns from the JSON-RPC method of the same name.
+    struct EXTERNAL IDeviceInfoExtended : virtual public Core::IUnknown {
+        enum { ID = ID_DEVICE_INFO_EXTENDED };
+
+        ~IDeviceInfoExtended() override = default;
+
+        // @event
+        struct EXTERNAL INotification : virtual public Core::IUnknown {
+            enum { ID = ID_DEVICE_INFO_EXTENDED_NOTIFICATION };
+
+            ~INotification() override = default;
+
+            // @brief The ESTB IP changed, e.g. after a DHCP renewal; only raised while the network fields come from RTNETLINK
+            // @param ip New address, empty when the interface lost it
+            virtual void EstbIpChanged(const string& ip) {}
+
+            // @brief A thermal zone reached the configured threshold, or dropped below it by the hysteresis again
+            // @param zone Thermal zone type
+            // @param temperature Millidegree Celsius
+            // @param above True when the threshold was reached, false when it cleared
+            virtual void ThermalThreshold(const string& zone, const int32_t temperature, const bool above) {}
+
+            // @brief A configured PSI trigger fired
+            // @param resource "memory", "cpu" or "io"
+            // @param pressure {"some":{"avg10","avg60","avg300","total"},"full":{...}} right after it fired, empty when it could not be read
+            virtual void PressureStall(const string& resource, const string& pressure) {}
+        };
+
+        virtual Core::hresult Register(INotification* notification) = 0;
+        virtual Core::hresult Unregister(INotification* notification) = 0;
+
+        // @brief Forgets every remembered backend miss and, when it is enabled, rebuilds the identity snapshot
+        virtual Core::hresult RefreshIdentity() = 0;
+
+        // @brief Hit, miss, skip and latency counters of every backend source
+        // @param statistics {"sources":[{"name","hits","misses","skips","latency"}]}, latency in microseconds
+        virtual Core::hresult SourceStatistics(string& statistics /* @out */) const = 0;
+
+        // @brief eth_mac, estb_mac, wifi_mac and estb_ip with at most one getDeviceDetails.sh run, and one more per field it did not report
+        // @param ethMac Empty when it could not be resolved, as the other fields
+        // @retval ERROR_TIMEDOUT: The script run timed out
+        virtual Core::hresult NetworkIdentity(string& ethMac /* @out */, string& estbMac /* @out */, string& wifiMac /* @out */, string& estbIp /* @out */) const = 0;
+
+        // @brief Every interface with all of its addresses, prefix lengths and scopes, served from the interface model
+        // @param interfaces Name glob, empty for all
+        // @param up Only interfaces that are up
+        // @param hasAddress Only interfaces with an address left after the family selection
+        // @param family "ipv4", "ipv6" or empty for both
+        // @param addresses {"interfaces":[{"name","mac","addresses":[{"address","family","prefix","scope"}]}]}
+        // @retval ERROR_BAD_REQUEST: Unknown family
+        virtual Core::hresult NetworkAddresses(const string& interfaces, const bool up, const bool hasAddress, const string& family, string& addresses /* @out */) const = 0;
+
+        // @brief Load and memory samples of the SystemInfo() sampler, oldest first
+        // @param window Seconds to go back
+        // @param samples {"samples":[{"time","cpuload","freeram","freeswap","avg1min","avg5min","avg15min"}]}, time in ms
+        // @retval ERROR_UNAVAILABLE: No history is kept
+        virtual Core::hresult SystemInfoHistory(const uint32_t window, string& samples /* @out */) const = 0;
+
+        // @brief The SystemInfo() members named in fields and nothing else, from the latest sample; the serial number and version are only looked up when asked for
+        // @param fields JSON array of member names, e.g. ["cpuload","freeram"]; besides the SystemInfo() members "availableram", "cachedram" and "cmafree" are known. Empty for all
+        // @param info JSON object with the requested members
+        // @retval ERROR_BAD_REQUEST: Unknown member name
+        virtual Core::hresult SystemInfoFields(const string& fields, string& info /* @out */) const = 0;
+
+        // @brief Thermal zone temperatures, cooling device states and per core cpufreq
+        // @param info {"zones":[{"name","temperature"}],"coolingdevices":[{"name","state","maxstate","transitions"}],"cpus":[{"cpu","frequency","maxfrequency"}],"time"}, time in ms; transitions counts the throttle steps of a device
+        // @retval ERROR_UNAVAILABLE: The platform exports neither thermal zones, cooling devices nor cpufreq
+        virtual Core::hresult ThermalInfo(string& info /* @out */) const = 0;
+
+        // @brief PSI averages and the Rss/Pss of the Thunder host and, when it runs in a process of its own, of the implementation
+        // @param host Process id of the Thunder host
+        // @param pressure {"memory","cpu","io":{"some","full":{"avg10","avg60","avg300","total"}},"host","implementation":{"pid","rss","pss"}}; a resource the kernel does not report is left out
+        virtual Core::hresult MemoryPressure(const uint32_t host, string& pressure /* @out */) const = 0;
+    };
+
+} // namespace Exchange
+} // namespace WPEFramework
@@ -0,0 +1,464 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2026 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+#include "NetlinkMonitor.h"
+
+#include <arpa/inet.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <net/if.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace WPEFramework {
+namespace Plugin {
+    namespace {
+
+        string HardwareAddress(const uint8_t bytes[], const size_t length)
+        {
+            static const char Hex[] = "0123456789abcdef";
+            string mac;
+
+            for (size_t index = 0; index < length; index++) {
+                if (index > 0) {
+                    mac += ':';
+                }
+                mac += Hex[bytes[index] >> 4];
+                mac += Hex[bytes[index] & 0x0F];
+            }
+
+            return mac;
+        }
+
+        bool Global(const NetlinkMonitor::Address& address)
+        {
+            return (address.family == AF_INET6) && (address.scope == RT_SCOPE_UNIVERSE);
+        }
+
+        // Applies one RTM_* message to the model; the name of every interface
+        // whose addresses changed is added to changed.
+        bool Apply(std::map<int, NetlinkMonitor::Link>& links, const struct nlmsghdr* header, std::set<string>& changed)
+        {
+            bool modified = false;
+
+            if ((header->nlmsg_type == RTM_NEWLINK) || (header->nlmsg_type == RTM_DELLINK)) {
+                const struct ifinfomsg* info = static_cast<const struct ifinfomsg*>(NLMSG_DATA(header));
+
+                if (header->nlmsg_type == RTM_DELLINK) {
+                    auto index = links.find(info->ifi_index);
+                    if (index != links.end()) {
+                        changed.insert(index->second.name);
+                        links.erase(index);
+                        modified = true;
+                    }
+                } else {
+                    string name;
+                    string mac;
+                    int length = IFLA_PAYLOAD(header);
+
+                    for (const struct rtattr* attribute = IFLA_RTA(info); RTA_OK(attribute, length); attribute = RTA_NEXT(attribute, length)) {
+                        if (attribute->rta_type == IFLA_IFNAME) {
+                            name = static_cast<const char*>(RTA_DATA(attribute));
+                        } else if (attribute->rta_type == IFLA_ADDRESS) {
+                            mac = HardwareAddress(static_cast<const uint8_t*>(RTA_DATA(attribute)), RTA_PAYLOAD(attribute));
+                        }
+                    }
+
+                    NetlinkMonitor::Link& link(links[info->ifi_index]);
+                    if ((link.name != name) || (link.mac != mac) || (link.flags != info->ifi_flags)) {
+                        link.name = name;
+                        link.mac = mac;
+                        link.flags = info->ifi_flags;
+                        modified = true;
+                    }
+                }
+            } else if ((header->nlmsg_type == RTM_NEWADDR) || (header->nlmsg_type == RTM_DELADDR)) {
+                const struct ifaddrmsg* info = static_cast<const struct ifaddrmsg*>(NLMSG_DATA(header));
+
+                if ((info->ifa_family == AF_INET) || (info->ifa_family == AF_INET6)) {
+                    const void* local = nullptr;
+                    const void* address = nullptr;
+                    int length = IFA_PAYLOAD(header);
+
+                    for (const struct rtattr* attribute = IFA_RTA(info); RTA_OK(attribute, length); attribute = RTA_NEXT(attribute, length)) {
+                        if (attribute->rta_type == IFA_LOCAL) {
+                            local = RTA_DATA(attribute);
+                        } else if (attribute->rta_type == IFA_ADDRESS) {
+                            address = RTA_DATA(attribute);
+                        }
+                    }
+
+                    // IFA_ADDRESS is the peer on point-to-point links, IFA_LOCAL the own address.
+                    char text[INET6_ADDRSTRLEN];
+                    const void* own = (local != nullptr) ? local : address;
+
+                    if ((own != nullptr) && (inet_ntop(info->ifa_family, own, text, sizeof(text)) != nullptr)) {
+                        NetlinkMonitor::Link& link(links[static_cast<int>(info->ifa_index)]);
+                        auto entry = link.addresses.begin();
+                        while ((entry != link.addresses.end()) && ((entry->family != info->ifa_family) || (entry->address != text))) {
+                            entry++;
+                        }
+
+                        if (header->nlmsg_type == RTM_DELADDR) {
+                            if (entry != link.addresses.end()) {
+                                link.addresses.erase(entry);
+                                modified = true;
+                            }
+                        } else if (entry == link.addresses.end()) {
+                            link.addresses.push_back({ info->ifa_family, text, info->ifa_prefixlen, info->ifa_scope });
+                            modified = true;
+                        } else if ((entry->prefix != info->ifa_prefixlen) || (entry->scope != info->ifa_scope)) {
+                            entry->prefix = info->ifa_prefixlen;
+                            entry->scope = info->ifa_scope;
+                            modified = true;
+                        }
+
+                        if ((modified == true) && (link.name.empty() == false)) {
+                            changed.insert(link.name);
+                        }
+                    }
+                }
+            }
+
+            return modified;
+        }
+    }
+
+    NetlinkMonitor::NetlinkMonitor()
+        : _adminLock()
+        , _links()
+        , _generation(0)
+        , _running(false)
+        , _callback(nullptr)
+        , _socket(-1)
+        , _wakeup(-1)
+        , _sequence(0)
+        , _thread()
+    {
+    }
+
+    NetlinkMonitor::~NetlinkMonitor()
+    {
+        Stop();
+    }
+
+    uint32_t NetlinkMonitor::Start(ICallback* callback)
+    {
+        const int route = socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, NETLINK_ROUTE);
+        if (route < 0) {
+            TRACE(Trace::Error, (_T("Could not open the RTNETLINK socket: %d"), errno));
+            return Core::ERROR_UNAVAILABLE;
+        }
+
+        struct sockaddr_nl local;
+        memset(&local, 0, sizeof(local));
+        local.nl_family = AF_NETLINK;
+        local.nl_groups = RTMGRP_LINK | RTMGRP_IPV4_IFADDR | RTMGRP_IPV6_IFADDR;
+
+        if (bind(route, reinterpret_cast<struct sockaddr*>(&local), sizeof(local)) != 0) {
+            TRACE(Trace::Error, (_T("Could not subscribe to RTNETLINK: %d"), errno));
+            close(route);
+            return Core::ERROR_GENERAL;
+        }
+
+        return (Start(callback, route));
+    }
+
+    uint32_t NetlinkMonitor::Start(ICallback* callback, const int descriptor)
+    {
+        ASSERT(_running == false);
+
+        _socket = descriptor;
+        _wakeup = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+
+        if ((_wakeup < 0) || (Synchronize() == false)) {
+            TRACE(Trace::Error, (_T("Could not read the interfaces from RTNETLINK: %d"), errno));
+            close(_socket);
+            _socket = -1;
+            if (_wakeup >= 0) {
+                close(_wakeup);
+                _wakeup = -1;
+            }
+            return Core::ERROR_GENERAL;
+        }
+
+        _callback = callback;
+        _running = true;
+        _thread = std::thread(&NetlinkMonitor::Run, this);
+
+        return Core::ERROR_NONE;
+    }
+
+    void NetlinkMonitor::Stop()
+    {
+        if (_thread.joinable() == true) {
+            const uint64_t one = 1;
+            VARIABLE_IS_NOT_USED ssize_t written = write(_wakeup, &one, sizeof(one));
+            _thread.join();
+        }
+
+        _running = false;
+        _callback = nullptr;
+
+        if (_socket >= 0) {
+            close(_socket);
+            _socket = -1;
+        }
+        if (_wakeup >= 0) {
+            close(_wakeup);
+            _wakeup = -1;
+        }
+    }
+
+    bool NetlinkMonitor::Running() const
+    {
+        return (_running);
+    }
+
+    uint32_t NetlinkMonitor::Generation() const
+    {
+        return (_generation);
+    }
+
+    uint32_t NetlinkMonitor::MACAddress(const string& interfaceName, string& mac) const
+    {
+        uint32_t result = Core::ERROR_GENERAL;
+
+        _adminLock.Lock();
+
+        for (const auto& entry : _links) {
+            if (entry.second.name == interfaceName) {
+                if (entry.second.mac.empty() == false) {
+                    mac = entry.second.mac;
+                    result = Core::ERROR_NONE;
+                }
+                break;
+            }
+        }
+
+        _adminLock.Unlock();
+
+        for (char& c : mac) {
+            c = static_cast<char>(toupper(static_cast<unsigned char>(c)));
+        }
+
+        return result;
+    }
+
+    uint32_t NetlinkMonitor::IPAddress(const string& interfaceName, string& ip) const
+    {
+        uint32_t result = Core::ERROR_GENERAL;
+
+        _adminLock.Lock();
+
+        for (const auto& entry : _links) {
+            if (entry.second.name == interfaceName) {
+                const Address* ipv6 = nullptr;
+                for (const Address& address : entry.second.addresses) {
+                    if (address.family == AF_INET) {
+                        ip = address.address;
+                        result = Core::ERROR_NONE;
+                        break;
+                    }
+                    if ((ipv6 == nullptr) && (Global(address) == true)) {
+                        ipv6 = &address;
+                    }
+                }
+                if ((result != Core::ERROR_NONE) && (ipv6 != nullptr)) {
+                    ip = ipv6->address;
+                    result = Core::ERROR_NONE;
+                }
+                break;
+            }
+        }
+
+        _adminLock.Unlock();
+
+        return result;
+    }
+
+    void NetlinkMonitor::Links(std::list<Link>& links) const
+    {
+        _adminLock.Lock();
+
+        for (const auto& entry : _links) {
+            if (entry.second.name.empty() == false) {
+                links.push_back(entry.second);
+            }
+        }
+
+        _adminLock.Unlock();
+    }
+
+    /* static */ uint32_t NetlinkMonitor::Dump(std::list<Link>& links)
+    {
+        // Not bound to any group, so only the replies to the two dumps arrive.
+        NetlinkMonitor dump;
+
+        dump._socket = socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, NETLINK_ROUTE);
+        if (dump._socket < 0) {
+            TRACE_GLOBAL(Trace::Error, (_T("Could not open the RTNETLINK socket: %d"), errno));
+            return Core::ERROR_UNAVAILABLE;
+        }
+
+        if (dump.Synchronize() == false) {
+            TRACE_GLOBAL(Trace::Error, (_T("RTNETLINK dump failed: %d"), errno));
+            return Core::ERROR_GENERAL;
+        }
+
+        dump.Links(links);
+
+        return Core::ERROR_NONE;
+    }
+
+    void NetlinkMonitor::Run()
+    {
+        struct pollfd descriptors[2];
+        descriptors[0].fd = _wakeup;
+        descriptors[0].events = POLLIN;
+        descriptors[1].fd = _socket;
+        descriptors[1].events = POLLIN;
+
+        while (true) {
+            descriptors[0].revents = 0;
+            descriptors[1].revents = 0;
+
+            if (poll(descriptors, 2, -1) < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                TRACE(Trace::Error, (_T("RTNETLINK poll failed: %d"), errno));
+                break;
+            }
+            if ((descriptors[0].revents & POLLIN) != 0) {
+                break;
+            }
+            if ((descriptors[1].revents & POLLHUP) != 0) {
+                // Only a socket handed to Start() has another end that can go away.
+                TRACE(Trace::Error, (_T("RTNETLINK socket closed")));
+                break;
+            }
+            if ((descriptors[1].revents & POLLIN) != 0) {
+                std::set<string> changed;
+
+                if (Receive(_links, 0, changed) == false) {
+                    // Events were lost (ENOBUFS), so the model can not be trusted anymore.
+                    TRACE(Trace::Warning, (_T("RTNETLINK overrun, rebuilding the interface model")));
+                    changed.clear();
+                    if (Synchronize() == true) {
+                        changed.insert(string());
+                    }
+                }
+
+                Notify(changed);
+            }
+        }
+    }
+
+    bool NetlinkMonitor::Synchronize()
+    {
+        std::map<int, Link> links;
+        std::set<string> changed;
+
+        bool result = (Request(RTM_GETLINK, ++_sequence) == true) && (Receive(links, _sequence, changed) == true)
+            && (Request(RTM_GETADDR, ++_sequence) == true) && (Receive(links, _sequence, changed) == true);
+
+        if (result == true) {
+            _adminLock.Lock();
+            _links.swap(links);
+            _adminLock.Unlock();
+            _generation++;
+        }
+
+        return result;
+    }
+
+    bool NetlinkMonitor::Request(const uint16_t type, const uint32_t sequence)
+    {
+        struct {
+            struct nlmsghdr header;
+            struct rtgenmsg message;
+        } request;
+
+        memset(&request, 0, sizeof(request));
+        request.header.nlmsg_len = NLMSG_LENGTH(sizeof(request.message));
+        request.header.nlmsg_type = type;
+        request.header.nlmsg_flags = NLM_F_REQUEST | NLM_F_DUMP;
+        request.header.nlmsg_seq = sequence;
+        request.message.rtgen_family = AF_UNSPEC;
+
+        return (send(_socket, &request, request.header.nlmsg_len, MSG_NOSIGNAL) == static_cast<ssize_t>(request.header.nlmsg_len));
+    }
+
+    // With a sequence number, reads until the dump with that sequence is done;
+    // with 0 it handles a single datagram of events.
+    bool NetlinkMonitor::Receive(std::map<int, Link>& links, const uint32_t sequence, std::set<string>& changed)
+    {
+        alignas(struct nlmsghdr) char buffer[16384];
+        bool done = (sequence == 0);
+
+        do {
+            const ssize_t received = recv(_socket, buffer, sizeof(buffer), 0);
+
+            if ((received < 0) && (errno == EINTR)) {
+                continue;
+            }
+            if (received <= 0) {
+                return false;
+            }
+
+            bool modified = false;
+            int length = static_cast<int>(received);
+
+            _adminLock.Lock();
+
+            for (const struct nlmsghdr* header = reinterpret_cast<const struct nlmsghdr*>(buffer); NLMSG_OK(header, length); header = NLMSG_NEXT(header, length)) {
+                if ((header->nlmsg_type == NLMSG_DONE) || (header->nlmsg_type == NLMSG_ERROR)) {
+                    if ((sequence != 0) && (header->nlmsg_seq == sequence)) {
+                        done = true;
+                    }
+                } else if (Apply(links, header, changed) == true) {
+                    modified = true;
+                }
+            }
+
+            _adminLock.Unlock();
+
+            if (modified == true) {
+                _generation++;
+            }
+        } while (done == false);
+
+        return true;
+    }
+
+    void NetlinkMonitor::Notify(const std::set<string>& changed) const
+    {
+        if (_callback != nullptr) {
+            for (const string& name : changed) {
+                _callback->AddressChanged(name);
+            }
+        }
+    }
+
+} // namespace Plugin
+} // namespace WPEFramework
@@ -0,0 +1,111 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2026 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+#pragma once
+
+#include "Module.h"
+
+#include <atomic>
+#include <list>
+#include <map>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace WPEFramework {
+namespace Plugin {
+
+    // In-memory model of the network interfaces, their MACs and addresses,
+    // kept live from RTNETLINK (RTM_NEWLINK/DELLINK, RTM_NEWADDR/DELADDR).
+    // The model is seeded with a link and an address dump in Start() and
+    // rebuilt the same way when the kernel reports a socket overrun, so
+    // lookups are served from memory without any system call.
+    class NetlinkMonitor {
+    public:
+        struct Address {
+            uint8_t family; // AF_INET or AF_INET6
+            string address;
+            uint8_t prefix;
+            uint8_t scope; // RT_SCOPE_*
+        };
+
+        struct Link {
+            string name;
+            string mac; // lower case, ':' separated; empty when the link has none
+            uint32_t flags; // IFF_*
+            std::vector<Address> addresses;
+        };
+
+        struct ICallback {
+            virtual ~ICallback() = default;
+
+            // Called from the monitor thread after addresses of the interface
+            // changed; an empty name means the whole model was rebuilt.
+            virtual void AddressChanged(const string& interfaceName) = 0;
+        };
+
+        NetlinkMonitor(const NetlinkMonitor&) = delete;
+        NetlinkMonitor& operator=(const NetlinkMonitor&) = delete;
+
+        NetlinkMonitor();
+        ~NetlinkMonitor();
+
+    public:
+        uint32_t Start(ICallback* callback);
+        // Takes over a socket that already answers like RTNETLINK, e.g. one end
+        // of a socketpair in tests; it is closed by Stop(), or right away on failure.
+        uint32_t Start(ICallback* callback, const int descriptor);
+        void Stop();
+        bool Running() const;
+
+        // Changes whenever a link or an address is added, changed or removed.
+        uint32_t Generation() const;
+
+        // Same results as NetworkInterfaces, served from the model.
+        uint32_t MACAddress(const string& interfaceName, string& mac) const;
+        uint32_t IPAddress(const string& interfaceName, string& ip) const;
+
+        // Every link in interface index order.
+        void Links(std::list<Link>& links) const;
+
+        // The same model from a single link and address dump on a private
+        // socket, for callers that do not keep a monitor running.
+        static uint32_t Dump(std::list<Link>& links);
+
+    private:
+        void Run();
+        bool Synchronize();
+        bool Request(const uint16_t type, const uint32_t sequence);
+        bool Receive(std::map<int, Link>& links, const uint32_t sequence, std::set<string>& changed);
+        void Notify(const std::set<string>& changed) const;
+
+    private:
+        mutable Core::CriticalSection _adminLock;
+        std::map<int, Link> _links;
+        std::atomic<uint32_t> _generation;
+        std::atomic<bool> _running;
+        ICallback* _callback;
+        int _socket;
+        int _wakeup;
+        uint32_t _sequence;
+        std::thread _thread;
+    };
+
+} // namespace Plugin
+} // namespace WPEFramework
@@ -0,0 +1,180 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2026 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+#include "NetworkInterfaces.h"
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <ifaddrs.h>
+#include <net/if.h>
+#include <netinet/in.h>
+#include <unistd.h>
+
+namespace WPEFramework {
+namespace Plugin {
+    namespace {
+
+        struct RoleEntry {
+            const TCHAR* property;
+            const TCHAR* fallback;
+        };
+
+        // Indexed by NetworkInterfaces::role.
+        const RoleEntry Roles[] = {
+            { _T("ETHERNET_INTERFACE"), _T("eth0") },
+            { _T("ESTB_INTERFACE"), _T("eth0") },
+            { _T("WIFI_INTERFACE"), _T("wlan0") }
+        };
+
+        bool ValidInterface(const string& name)
+        {
+            return (name.empty() == false) && (name.length() < IFNAMSIZ) && (name.find('/') == string::npos)
+                && (name != _T(".")) && (name != _T(".."));
+        }
+    }
+
+    NetworkInterfaces::NetworkInterfaces(const DevicePropertiesStore& properties)
+        : _properties(properties)
+        , _adminLock()
+        , _names()
+        , _monitor(nullptr)
+    {
+        static_assert((sizeof(Roles) / sizeof(Roles[0])) == ROLES, "Roles table does not match the role enum");
+    }
+
+    void NetworkInterfaces::Configure(const role which, const string& name)
+    {
+        ASSERT(which < ROLES);
+
+        _adminLock.Lock();
+        _names[which] = name;
+        _adminLock.Unlock();
+    }
+
+    string NetworkInterfaces::Interface(const role which) const
+    {
+        ASSERT(which < ROLES);
+
+        _adminLock.Lock();
+        string name(_names[which]);
+        _adminLock.Unlock();
+
+        if ((name.empty() == true) && (_properties.Get(Roles[which].property, name) != Core::ERROR_NONE)) {
+            name = Roles[which].fallback;
+        }
+
+        return name;
+    }
+
+    void NetworkInterfaces::Source(const NetlinkMonitor* monitor)
+    {
+        _monitor = monitor;
+    }
+
+    uint32_t NetworkInterfaces::MACAddress(const role which, string& mac) const
+    {
+        uint32_t result = Core::ERROR_GENERAL;
+        const string name(Interface(which));
+        const NetlinkMonitor* monitor = _monitor;
+
+        if ((monitor != nullptr) && (monitor->Running() == true)) {
+            return (monitor->MACAddress(name, mac));
+        }
+
+        if (ValidInterface(name) == false) {
+            TRACE(Trace::Error, (_T("Invalid interface name '%s'"), name.c_str()));
+            return result;
+        }
+
+        const string path = _T("/sys/class/net/") + name + _T("/address");
+        const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+        if (fd >= 0) {
+            char buffer[64];
+            const ssize_t length = read(fd, buffer, sizeof(buffer));
+            close(fd);
+
+            if (length > 0) {
+                size_t end = static_cast<size_t>(length);
+                while ((end > 0) && ((buffer[end - 1] == '\n') || (buffer[end - 1] == ' '))) {
+                    end--;
+                }
+                if (end > 0) {
+                    mac.assign(buffer, end);
+                    for (char& c : mac) {
+                        c = static_cast<char>(toupper(static_cast<unsigned char>(c)));
+                    }
+                    result = Core::ERROR_NONE;
+                }
+            }
+        }
+
+        return result;
+    }
+
+    uint32_t NetworkInterfaces::IPAddress(const role which, string& ip) const
+    {
+        uint32_t result = Core::ERROR_GENERAL;
+        const string name(Interface(which));
+        const NetlinkMonitor* monitor = _monitor;
+        struct ifaddrs* addresses = nullptr;
+
+        if ((monitor != nullptr) && (monitor->Running() == true)) {
+            return (monitor->IPAddress(name, ip));
+        }
+
+        if (getifaddrs(&addresses) != 0) {
+            TRACE(Trace::Error, (_T("getifaddrs failed: %d"), errno));
+            return result;
+        }
+
+        char text[INET6_ADDRSTRLEN];
+        string ipv6;
+
+        for (const struct ifaddrs* entry = addresses; (entry != nullptr) && (result != Core::ERROR_NONE); entry = entry->ifa_next) {
+            if ((entry->ifa_addr == nullptr) || (name != entry->ifa_name)) {
+                continue;
+            }
+            if (entry->ifa_addr->sa_family == AF_INET) {
+                const struct sockaddr_in* address = reinterpret_cast<const struct sockaddr_in*>(entry->ifa_addr);
+                if (inet_ntop(AF_INET, &address->sin_addr, text, sizeof(text)) != nullptr) {
+                    ip = text;
+                    result = Core::ERROR_NONE;
+                }
+            } else if ((entry->ifa_addr->sa_family == AF_INET6) && (ipv6.empty() == true)) {
+                const struct sockaddr_in6* address = reinterpret_cast<const struct sockaddr_in6*>(entry->ifa_addr);
+                if ((IN6_IS_ADDR_LINKLOCAL(&address->sin6_addr) == false) && (IN6_IS_ADDR_LOOPBACK(&address->sin6_addr) == false)
+                    && (inet_ntop(AF_INET6, &address->sin6_addr, text, sizeof(text)) != nullptr)) {
+                    ipv6 = text;
+                }
+            }
+        }
+
+        freeifaddrs(addresses);
+
+        if ((result != Core::ERROR_NONE) && (ipv6.empty() == false)) {
+            ip = ipv6;
+            result = Core::ERROR_NONE;
+        }
+
+        return result;
+    }
+
+} // namespace Plugin
+} // namespace WPEFramework
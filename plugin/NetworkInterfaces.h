@@ -0,0 +1,70 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2026 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+#pragma once
+
+#include "Module.h"
+#include "DevicePropertiesStore.h"
+#include "NetlinkMonitor.h"
+
+#include <atomic>
+
+namespace WPEFramework {
+namespace Plugin {
+
+    // Native replacement for "getDeviceDetails.sh read <role>_mac|estb_ip".
+    // Each role maps to a network interface: the configured name, else the
+    // <ROLE>_INTERFACE entry of device.properties, else a platform default.
+    // MACs come from sysfs and are reported in upper case like the script;
+    // the IP is the first IPv4 address of the interface, else its first
+    // global IPv6 address. With a running NetlinkMonitor as source, both are
+    // answered from its live model instead.
+    class NetworkInterfaces {
+    public:
+        enum role : uint8_t {
+            ETHERNET,
+            ESTB,
+            WIFI,
+            ROLES
+        };
+
+        NetworkInterfaces(const NetworkInterfaces&) = delete;
+        NetworkInterfaces& operator=(const NetworkInterfaces&) = delete;
+
+        explicit NetworkInterfaces(const DevicePropertiesStore& properties);
+        ~NetworkInterfaces() = default;
+
+    public:
+        // An empty name restores the device.properties/default lookup.
+        void Configure(const role which, const string& name);
+        string Interface(const role which) const;
+        void Source(const NetlinkMonitor* monitor);
+
+        uint32_t MACAddress(const role which, string& mac) const;
+        uint32_t IPAddress(const role which, string& ip) const;
+
+    private:
+        const DevicePropertiesStore& _properties;
+        mutable Core::CriticalSection _adminLock;
+        string _names[ROLES];
+        std::atomic<const NetlinkMonitor*> _monitor;
+    };
+
+} // namespace Plugin
+} // namespace WPEFramework
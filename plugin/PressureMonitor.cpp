@@ -0,0 +1,222 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2026 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+
+#include "PressureMonitor.h"
+
+#include <cinttypes>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace WPEFramework {
+namespace Plugin {
+    namespace {
+
+        const TCHAR* const Files[] = {
+            _T("/proc/pressure/memory"),
+            _T("/proc/pressure/cpu"),
+            _T("/proc/pressure/io")
+        };
+
+        const TCHAR* const Names[] = {
+            _T("memory"),
+            _T("cpu"),
+            _T("io")
+        };
+
+        bool ParseStall(const char line[], const char kind[], PressureMonitor::Stall& stall)
+        {
+            char format[64];
+            snprintf(format, sizeof(format), "%s avg10=%%lf avg60=%%lf avg300=%%lf total=%%" SCNu64, kind);
+
+            return (sscanf(line, format, &stall.avg10, &stall.avg60, &stall.avg300, &stall.total) == 4);
+        }
+    }
+
+    PressureMonitor::PressureMonitor()
+        : _running(false)
+        , _callback(nullptr)
+        , _triggers { -1, -1, -1 }
+        , _wakeup(-1)
+        , _thread()
+    {
+        static_assert((sizeof(Files) / sizeof(Files[0])) == RESOURCES, "Files table does not match the resource enum");
+        static_assert((sizeof(Names) / sizeof(Names[0])) == RESOURCES, "Names table does not match the resource enum");
+    }
+
+    PressureMonitor::~PressureMonitor()
+    {
+        Stop();
+    }
+
+    /* static */ const TCHAR* PressureMonitor::Name(const resource which)
+    {
+        ASSERT(which < RESOURCES);
+
+        return (Names[which]);
+    }
+
+    /* static */ uint32_t PressureMonitor::Read(const resource which, Pressure& pressure)
+    {
+        ASSERT(which < RESOURCES);
+
+        const int fd = open(Files[which], O_RDONLY | O_CLOEXEC);
+        if (fd == -1) {
+            return (Core::ERROR_UNAVAILABLE);
+        }
+
+        char buffer[256];
+        const ssize_t length = pread(fd, buffer, sizeof(buffer) - 1, 0);
+        close(fd);
+
+        if (length <= 0) {
+            return (Core::ERROR_UNAVAILABLE);
+        }
+        buffer[length] = '\0';
+
+        pressure = {};
+
+        // "full" is missing for cpu on kernels before 5.13 and stays zero then.
+        const char* full = strchr(buffer, '\n');
+        if ((full != nullptr) && (full[1] != '\0')) {
+            ParseStall(full + 1, "full", pressure.full);
+        }
+
+        return (ParseStall(buffer, "some", pressure.some) == true) ? Core::ERROR_NONE : Core::ERROR_GENERAL;
+    }
+
+    uint32_t PressureMonitor::Start(const string triggers[RESOURCES], ICallback* callback)
+    {
+        ASSERT(_running == false);
+        ASSERT(callback != nullptr);
+
+        bool watched = false;
+
+        for (uint8_t index = 0; index < RESOURCES; index++) {
+            if (triggers[index].empty() == true) {
+                continue;
+            }
+
+            _triggers[index] = open(Files[index], O_RDWR | O_NONBLOCK | O_CLOEXEC);
+
+            // The terminating zero is part of what the kernel parses.
+            if ((_triggers[index] == -1) || (write(_triggers[index], triggers[index].c_str(), triggers[index].length() + 1) < 0)) {
+                TRACE(Trace::Error, (_T("Could not set the %s pressure trigger \"%s\": %d"), Names[index], triggers[index].c_str(), errno));
+                Close();
+                return (Core::ERROR_UNAVAILABLE);
+            }
+
+            watched = true;
+        }
+
+        if (watched == false) {
+            return (Core::ERROR_NONE);
+        }
+
+        _wakeup = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+        if (_wakeup < 0) {
+            Close();
+            return (Core::ERROR_GENERAL);
+        }
+
+        _callback = callback;
+        _running = true;
+        _thread = std::thread(&PressureMonitor::Run, this);
+
+        return (Core::ERROR_NONE);
+    }
+
+    void PressureMonitor::Stop()
+    {
+        if (_thread.joinable() == true) {
+            const uint64_t one = 1;
+            VARIABLE_IS_NOT_USED ssize_t written = write(_wakeup, &one, sizeof(one));
+            _thread.join();
+        }
+
+        _running = false;
+        _callback = nullptr;
+
+        Close();
+    }
+
+    bool PressureMonitor::Running() const
+    {
+        return (_running);
+    }
+
+    void PressureMonitor::Close()
+    {
+        for (int& fd : _triggers) {
+            if (fd != -1) {
+                close(fd);
+                fd = -1;
+            }
+        }
+        if (_wakeup >= 0) {
+            close(_wakeup);
+            _wakeup = -1;
+        }
+    }
+
+    void PressureMonitor::Run()
+    {
+        struct pollfd descriptors[1 + RESOURCES];
+        descriptors[0].fd = _wakeup;
+        descriptors[0].events = POLLIN;
+        for (uint8_t index = 0; index < RESOURCES; index++) {
+            // poll() skips negative descriptors, so unwatched resources cost nothing.
+            descriptors[1 + index].fd = _triggers[index];
+            descriptors[1 + index].events = POLLPRI;
+        }
+
+        while (true) {
+            for (struct pollfd& descriptor : descriptors) {
+                descriptor.revents = 0;
+            }
+
+            if (poll(descriptors, 1 + RESOURCES, -1) < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                TRACE(Trace::Error, (_T("Pressure poll failed: %d"), errno));
+                break;
+            }
+            if ((descriptors[0].revents & POLLIN) != 0) {
+                break;
+            }
+
+            for (uint8_t index = 0; index < RESOURCES; index++) {
+                const short events = descriptors[1 + index].revents;
+
+                if ((events & POLLERR) != 0) {
+                    // The trigger went away with the cgroup or the file; stop watching it.
+                    TRACE(Trace::Warning, (_T("The %s pressure trigger is gone"), Names[index]));
+                    descriptors[1 + index].fd = -1;
+                } else if ((events & POLLPRI) != 0) {
+                    _callback->PressureStall(static_cast<resource>(index));
+                }
+            }
+        }
+    }
+
+} // namespace Plugin
+} // namespace WPEFramework
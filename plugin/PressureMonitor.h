@@ -0,0 +1,91 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2026 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+
+#pragma once
+
+#include "Module.h"
+
+#include <atomic>
+#include <thread>
+
+namespace WPEFramework {
+namespace Plugin {
+
+    // Pressure stall information (PSI) from /proc/pressure. Read() returns the
+    // current averages; Start() registers kernel triggers and reports, from
+    // its own thread, every time one of them fires, so nobody has to poll to
+    // notice a stall within the trigger window.
+    class PressureMonitor {
+    public:
+        enum resource : uint8_t {
+            MEMORY,
+            CPU,
+            IO,
+            RESOURCES
+        };
+
+        struct Stall {
+            double avg10; // %
+            double avg60;
+            double avg300;
+            uint64_t total; // us
+        };
+
+        struct Pressure {
+            Stall some;
+            Stall full;
+        };
+
+        struct ICallback {
+            virtual ~ICallback() = default;
+
+            virtual void PressureStall(const resource which) = 0;
+        };
+
+        PressureMonitor(const PressureMonitor&) = delete;
+        PressureMonitor& operator=(const PressureMonitor&) = delete;
+
+        PressureMonitor();
+        ~PressureMonitor();
+
+    public:
+        static const TCHAR* Name(const resource which);
+        static uint32_t Read(const resource which, Pressure& pressure);
+
+        // A trigger is "<some|full> <stall us> <window us>" as the kernel
+        // expects it; an empty one leaves the resource unwatched.
+        uint32_t Start(const string triggers[RESOURCES], ICallback* callback);
+        void Stop();
+        bool Running() const;
+
+    private:
+        void Run();
+        void Close();
+
+    private:
+        std::atomic<bool> _running;
+        ICallback* _callback;
+        int _triggers[RESOURCES];
+        int _wakeup;
+        std::thread _thread;
+    };
+
+} // namespace Plugin
+} // namespace WPEFramework
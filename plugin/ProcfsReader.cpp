@@ -0,0 +1,266 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2026 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+
+#include "ProcfsReader.h"
+
+#include <fcntl.h>
+#include <sys/sysinfo.h>
+#include <unistd.h>
+
+namespace WPEFramework {
+namespace Plugin {
+    namespace {
+
+        const char* SkipBlanks(const char* text, const char* const end)
+        {
+            while ((text < end) && ((*text == ' ') || (*text == '\t'))) {
+                text++;
+            }
+            return (text);
+        }
+
+        const char* Number(const char* text, const char* const end, uint64_t& value)
+        {
+            value = 0;
+            while ((text < end) && (*text >= '0') && (*text <= '9')) {
+                value = (value * 10) + (*text - '0');
+                text++;
+            }
+            return (text);
+        }
+
+        // "12.34" as fixed point with SI_LOAD_SHIFT fraction bits.
+        const char* LoadNumber(const char* text, const char* const end, uint64_t& value)
+        {
+            uint64_t integer = 0;
+            uint64_t fraction = 0;
+            uint64_t scale = 1;
+
+            text = Number(text, end, integer);
+            if ((text < end) && (*text == '.')) {
+                text++;
+                while ((text < end) && (*text >= '0') && (*text <= '9')) {
+                    fraction = (fraction * 10) + (*text - '0');
+                    scale *= 10;
+                    text++;
+                }
+            }
+
+            value = (integer << SI_LOAD_SHIFT) + ((fraction << SI_LOAD_SHIFT) / scale);
+            return (text);
+        }
+
+        struct MeminfoKey {
+            const char* name;
+            size_t length;
+            uint64_t ProcfsReader::Memory::*field;
+        };
+
+        const MeminfoKey MeminfoKeys[] = {
+            { "MemTotal:", 9, &ProcfsReader::Memory::total },
+            { "MemFree:", 8, &ProcfsReader::Memory::free },
+            { "MemAvailable:", 13, &ProcfsReader::Memory::available },
+            { "Cached:", 7, &ProcfsReader::Memory::cached },
+            { "SwapTotal:", 10, &ProcfsReader::Memory::swapTotal },
+            { "SwapFree:", 9, &ProcfsReader::Memory::swapFree },
+            { "CmaFree:", 8, &ProcfsReader::Memory::cmaFree }
+        };
+    }
+
+    ProcfsReader::ProcfsReader()
+        : _meminfo(open("/proc/meminfo", O_RDONLY | O_CLOEXEC))
+        , _stat(open("/proc/stat", O_RDONLY | O_CLOEXEC))
+        , _loadavg(open("/proc/loadavg", O_RDONLY | O_CLOEXEC))
+    {
+    }
+
+    ProcfsReader::~ProcfsReader()
+    {
+        for (const int fd : { _meminfo, _stat, _loadavg }) {
+            if (fd != -1) {
+                close(fd);
+            }
+        }
+    }
+
+    /* static */ size_t ProcfsReader::Read(const int fd, char buffer[], const size_t length)
+    {
+        const ssize_t size = (fd != -1) ? pread(fd, buffer, length, 0) : -1;
+
+        return ((size > 0) ? static_cast<size_t>(size) : 0);
+    }
+
+    uint32_t ProcfsReader::Meminfo(Memory& memory) const
+    {
+        char buffer[4096];
+        const size_t length = Read(_meminfo, buffer, sizeof(buffer));
+
+        if (length == 0) {
+            return (Core::ERROR_UNAVAILABLE);
+        }
+
+        memory = {};
+
+        const char* line = buffer;
+        const char* const end = buffer + length;
+        uint32_t missing = sizeof(MeminfoKeys) / sizeof(MeminfoKeys[0]);
+
+        while ((line < end) && (missing > 0)) {
+            const char* next = static_cast<const char*>(memchr(line, '\n', end - line));
+            const char* const eol = (next != nullptr) ? next : end;
+
+            for (const MeminfoKey& key : MeminfoKeys) {
+                if ((static_cast<size_t>(eol - line) > key.length) && (memcmp(line, key.name, key.length) == 0)) {
+                    uint64_t kilobytes;
+                    Number(SkipBlanks(line + key.length, eol), eol, kilobytes);
+                    memory.*key.field = kilobytes * 1024;
+                    missing--;
+                    break;
+                }
+            }
+
+            line = eol + 1;
+        }
+
+        return (Core::ERROR_NONE);
+    }
+
+    uint32_t ProcfsReader::CpuLoad(CpuBaseline& baseline, uint32_t& load) const
+    {
+        // Only the aggregate "cpu " line at the start is needed.
+        char buffer[256];
+        const size_t length = Read(_stat, buffer, sizeof(buffer));
+
+        if ((length < 4) || (memcmp(buffer, "cpu ", 4) != 0)) {
+            return (Core::ERROR_UNAVAILABLE);
+        }
+
+        const char* text = buffer + 4;
+        const char* const end = buffer + length;
+        uint64_t total = 0;
+        uint64_t idle = 0;
+
+        // user nice system idle iowait irq softirq steal; guest time is part of user.
+        for (uint8_t column = 0; column < 8; column++) {
+            uint64_t ticks;
+            text = Number(SkipBlanks(text, end), end, ticks);
+            total += ticks;
+            if ((column == 3) || (column == 4)) {
+                idle += ticks;
+            }
+        }
+
+        baseline._adminLock.Lock();
+
+        const uint64_t elapsed = total - baseline._total;
+        const uint64_t idled = idle - baseline._idle;
+        baseline._total = total;
+        baseline._idle = idle;
+
+        baseline._adminLock.Unlock();
+
+        load = (elapsed > 0) ? static_cast<uint32_t>(((elapsed - idled) * 100) / elapsed) : 0;
+
+        return (Core::ERROR_NONE);
+    }
+
+    uint32_t ProcfsReader::LoadAverage(uint64_t averages[3]) const
+    {
+        char buffer[128];
+        const size_t length = Read(_loadavg, buffer, sizeof(buffer));
+
+        if (length == 0) {
+            return (Core::ERROR_UNAVAILABLE);
+        }
+
+        const char* text = buffer;
+        const char* const end = buffer + length;
+
+        for (uint8_t index = 0; index < 3; index++) {
+            text = LoadNumber(SkipBlanks(text, end), end, averages[index]);
+        }
+
+        return (Core::ERROR_NONE);
+    }
+
+    void ProcfsReader::Sample(CpuBaseline& baseline, Figures& figures) const
+    {
+        Core::SystemInfo& singleton(Core::SystemInfo::Instance());
+
+        if (Meminfo(figures.memory) != Core::ERROR_NONE) {
+            figures.memory = {};
+            figures.memory.total = singleton.GetTotalRam();
+            figures.memory.free = singleton.GetFreeRam();
+            figures.memory.swapTotal = singleton.GetTotalSwap();
+            figures.memory.swapFree = singleton.GetFreeSwap();
+        }
+
+        if (CpuLoad(baseline, figures.cpuLoad) != Core::ERROR_NONE) {
+            figures.cpuLoad = static_cast<uint32_t>(singleton.GetCpuLoad());
+        }
+
+        if (LoadAverage(figures.averages) != Core::ERROR_NONE) {
+            const uint64_t* averages = singleton.GetCpuLoadAvg();
+            for (uint8_t index = 0; index < 3; index++) {
+                figures.averages[index] = (averages != nullptr) ? averages[index] : 0;
+            }
+        }
+    }
+
+    /* static */ uint32_t ProcfsReader::Rollup(const pid_t pid, uint64_t& rss, uint64_t& pss)
+    {
+        char path[48];
+        snprintf(path, sizeof(path), "/proc/%d/smaps_rollup", static_cast<int>(pid));
+
+        const int fd = open(path, O_RDONLY | O_CLOEXEC);
+        char buffer[1024];
+        const size_t length = Read(fd, buffer, sizeof(buffer));
+
+        if (fd != -1) {
+            close(fd);
+        }
+
+        uint8_t found = 0;
+        const char* line = buffer;
+        const char* const end = buffer + length;
+
+        while ((line < end) && (found != 0x03)) {
+            const char* next = static_cast<const char*>(memchr(line, '\n', end - line));
+            const char* const eol = (next != nullptr) ? next : end;
+            uint64_t kilobytes;
+
+            if (((eol - line) > 4) && (memcmp(line, "Rss:", 4) == 0)) {
+                Number(SkipBlanks(line + 4, eol), eol, kilobytes);
+                rss = kilobytes * 1024;
+                found |= 0x01;
+            } else if (((eol - line) > 4) && (memcmp(line, "Pss:", 4) == 0)) {
+                Number(SkipBlanks(line + 4, eol), eol, kilobytes);
+                pss = kilobytes * 1024;
+                found |= 0x02;
+            }
+
+            line = eol + 1;
+        }
+
+        return ((found == 0x03) ? Core::ERROR_NONE : Core::ERROR_UNAVAILABLE);
+    }
+
+} // namespace Plugin
+} // namespace WPEFramework
@@ -0,0 +1,112 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2026 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+
+#pragma once
+
+#include "Module.h"
+
+namespace WPEFramework {
+namespace Plugin {
+
+    // Memory, CPU and load figures straight from /proc/meminfo, /proc/stat and
+    // /proc/loadavg. The files are opened once, re-read with pread() into a
+    // stack buffer and parsed as integers in place, so a sample makes three
+    // system calls and no heap allocation. Every method returns
+    // ERROR_UNAVAILABLE when its file could not be opened.
+    class ProcfsReader {
+    public:
+        // Bytes.
+        struct Memory {
+            uint64_t total;
+            uint64_t free;
+            uint64_t available;
+            uint64_t cached;
+            uint64_t swapTotal;
+            uint64_t swapFree;
+            uint64_t cmaFree;
+        };
+
+        // What SystemInfo() reports from procfs.
+        struct Figures {
+            Memory memory;
+            uint32_t cpuLoad; // percent
+            uint64_t averages[3]; // as LoadAverage()
+        };
+
+        // The /proc/stat counters of the previous CpuLoad() call. Every
+        // consumer keeps its own, so one caller does not shorten the
+        // interval the load of another one is computed over.
+        class CpuBaseline {
+        public:
+            CpuBaseline(const CpuBaseline&) = delete;
+            CpuBaseline& operator=(const CpuBaseline&) = delete;
+
+            CpuBaseline()
+                : _adminLock()
+                , _total(0)
+                , _idle(0)
+            {
+            }
+            ~CpuBaseline() = default;
+
+        private:
+            friend class ProcfsReader;
+
+            Core::CriticalSection _adminLock;
+            uint64_t _total;
+            uint64_t _idle;
+        };
+
+        ProcfsReader(const ProcfsReader&) = delete;
+        ProcfsReader& operator=(const ProcfsReader&) = delete;
+
+        ProcfsReader();
+        ~ProcfsReader();
+
+    public:
+        uint32_t Meminfo(Memory& memory) const;
+
+        // Percentage of the time not spent idle since the previous call with
+        // the same baseline (since boot on the first one).
+        uint32_t CpuLoad(CpuBaseline& baseline, uint32_t& load) const;
+
+        // 1, 5 and 15 minute averages as sysinfo() reports them: fixed point,
+        // shifted left by SI_LOAD_SHIFT.
+        uint32_t LoadAverage(uint64_t averages[3]) const;
+
+        // Meminfo(), CpuLoad() and LoadAverage() in one go; a figure whose file
+        // can not be read comes from Core::SystemInfo (sysinfo()) instead, which
+        // leaves available, cached and cmaFree at 0.
+        void Sample(CpuBaseline& baseline, Figures& figures) const;
+
+        // Rss and Pss of a process in bytes, from /proc/<pid>/smaps_rollup.
+        static uint32_t Rollup(const pid_t pid, uint64_t& rss, uint64_t& pss);
+
+    private:
+        static size_t Read(const int fd, char buffer[], const size_t length);
+
+    private:
+        const int _meminfo;
+        const int _stat;
+        const int _loadavg;
+    };
+
+} // namespace Plugin
+} // namespace WPEFramework
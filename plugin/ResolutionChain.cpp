@@ -0,0 +1,179 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2026 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+
+#include "ResolutionChain.h"
+
+#include <chrono>
+
+namespace WPEFramework {
+namespace Plugin {
+
+    namespace {
+
+        // Microseconds on the monotonic clock; a wall clock step (NTP, manual
+        // set) neither stretches nor cuts short a negative cache expiry.
+        uint64_t MonotonicNow()
+        {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+        }
+
+    }
+
+    ValueSource::ValueSource(const string& name)
+        : _name(name)
+        , _adminLock()
+        , _absent(false)
+        , _absentGeneration(0)
+        , _negativeExpiry(0)
+        , _emptyUntil(0)
+        , _prefetched(false)
+        , _prefetchedValue()
+        , _hits(0)
+        , _misses(0)
+        , _skips(0)
+        , _latency(0)
+    {
+    }
+
+    bool ValueSource::Fetch(string& value) const
+    {
+        const uint32_t generation = Generation();
+        const uint64_t now = MonotonicNow();
+
+        _adminLock.Lock();
+        if (_prefetched == true) {
+            value = _prefetchedValue;
+            _adminLock.Unlock();
+            _hits++;
+            return (true);
+        }
+        const bool skip = ((_absent == true) && (_absentGeneration == generation)) || (now < _emptyUntil);
+        _adminLock.Unlock();
+
+        if (skip == true) {
+            _skips++;
+            return (false);
+        }
+
+        const outcome result = Read(value);
+        const uint64_t end = MonotonicNow();
+        _latency += (end - now);
+
+        if (result == FOUND) {
+            _hits++;
+        } else {
+            _misses++;
+
+            if (result == ABSENT) {
+                _adminLock.Lock();
+                if ((_absent == false) || (_absentGeneration != generation)) {
+                    TRACE(Trace::Information, (_T("%s has no value, skipping it until it changes"), _name.c_str()));
+                }
+                _absent = true;
+                _absentGeneration = generation;
+                _adminLock.Unlock();
+            } else if (result == EMPTY) {
+                _adminLock.Lock();
+                if (_negativeExpiry > 0) {
+                    _emptyUntil = end + _negativeExpiry;
+                }
+                _adminLock.Unlock();
+            }
+        }
+
+        return (result == FOUND);
+    }
+
+    void ValueSource::Prefetch()
+    {
+        string value;
+
+        if (Fetch(value) == true) {
+            _adminLock.Lock();
+            _prefetchedValue = std::move(value);
+            _prefetched = true;
+            _adminLock.Unlock();
+        }
+    }
+
+    void ValueSource::NegativeExpiry(const uint32_t seconds)
+    {
+        _adminLock.Lock();
+        _negativeExpiry = static_cast<uint64_t>(seconds) * Core::Time::MicroSecondsPerSecond;
+        _emptyUntil = 0;
+        _adminLock.Unlock();
+    }
+
+    void ValueSource::Reset()
+    {
+        _adminLock.Lock();
+        _absent = false;
+        _emptyUntil = 0;
+        _prefetched = false;
+        _prefetchedValue.clear();
+        _adminLock.Unlock();
+    }
+
+    void ValueSource::Snapshot(Statistics& statistics) const
+    {
+        statistics.name = _name;
+        statistics.hits = _hits;
+        statistics.misses = _misses;
+        statistics.skips = _skips;
+        statistics.latency = _latency;
+    }
+
+    ResolutionChain::ResolutionChain(const string& field, const std::vector<const ValueSource*>& sources)
+        : _field(field)
+        , _sources(sources)
+        , _winner(-1)
+    {
+    }
+
+    uint32_t ResolutionChain::Resolve(string& value) const
+    {
+        uint32_t result = Core::ERROR_GENERAL;
+        string candidate;
+
+        for (size_t index = 0; index < _sources.size(); index++) {
+            if (_sources[index]->Fetch(candidate) == true) {
+                const int32_t previous = _winner.exchange(static_cast<int32_t>(index));
+                if (previous != static_cast<int32_t>(index)) {
+                    TRACE(Trace::Information, (_T("%s resolved from %s"), _field.c_str(), _sources[index]->Name().c_str()));
+                }
+                value = std::move(candidate);
+                result = Core::ERROR_NONE;
+                break;
+            }
+        }
+
+        return (result);
+    }
+
+    const ValueSource* ResolutionChain::Winner() const
+    {
+        const int32_t winner = _winner;
+
+        return ((winner >= 0) ? _sources[winner] : nullptr);
+    }
+
+} // namespace Plugin
+} // namespace WPEFramework
@@ -0,0 +1,138 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2026 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+
+#pragma once
+
+#include "Module.h"
+
+#include <atomic>
+#include <vector>
+
+namespace WPEFramework {
+namespace Plugin {
+
+    // One backend a field can be read from: an MFR serialized type, an RFC
+    // parameter or a key in a file. Besides reading, a source keeps its own
+    // hit/miss/latency accounting and remembers definitive misses, so chains
+    // skip it until the data behind it changes.
+    class ValueSource {
+    public:
+        enum outcome : uint8_t {
+            FOUND,
+            MISSING, // failed this time, may succeed on the next attempt
+            EMPTY, // the backend answered without a value; cached for NegativeExpiry()
+            ABSENT // can not succeed while Generation() is unchanged
+        };
+
+        struct Statistics {
+            string name;
+            uint32_t hits;
+            uint32_t misses;
+            uint32_t skips;
+            uint64_t latency; // accumulated read time, in microseconds
+        };
+
+        ValueSource(const ValueSource&) = delete;
+        ValueSource& operator=(const ValueSource&) = delete;
+
+        explicit ValueSource(const string& name);
+        virtual ~ValueSource() = default;
+
+    public:
+        const string& Name() const
+        {
+            return (_name);
+        }
+
+        // True and the value if the source produced one; skipped without a
+        // backend call while a previous ABSENT outcome is still valid or an
+        // EMPTY outcome has not expired.
+        bool Fetch(string& value) const;
+
+        // Reads the source ahead of its first use; a value found is served by
+        // Fetch() from memory until Reset().
+        void Prefetch();
+
+        // How long an EMPTY answer is remembered; 0 (the default) disables it.
+        void NegativeExpiry(const uint32_t seconds);
+
+        // Forgets prefetched values and definitive and cached misses, e.g.
+        // after re-provisioning.
+        void Reset();
+
+        void Snapshot(Statistics& statistics) const;
+
+    protected:
+        virtual outcome Read(string& value) const = 0;
+
+        // Identifies the state of the data behind the source; sources without
+        // such a notion keep an ABSENT outcome until Reset().
+        virtual uint32_t Generation() const
+        {
+            return (0);
+        }
+
+    private:
+        const string _name;
+        mutable Core::CriticalSection _adminLock;
+        mutable bool _absent;
+        mutable uint32_t _absentGeneration;
+        uint64_t _negativeExpiry;
+        mutable uint64_t _emptyUntil;
+        bool _prefetched;
+        string _prefetchedValue;
+        mutable std::atomic<uint32_t> _hits;
+        mutable std::atomic<uint32_t> _misses;
+        mutable std::atomic<uint32_t> _skips;
+        mutable std::atomic<uint64_t> _latency;
+    };
+
+    // Ordered list of sources for one field; the first source that yields a
+    // value wins. The winning source is remembered and reported when it
+    // changes, sources known to be absent are not queried again.
+    class ResolutionChain {
+    public:
+        ResolutionChain(const ResolutionChain&) = delete;
+        ResolutionChain& operator=(const ResolutionChain&) = delete;
+
+        ResolutionChain(const string& field, const std::vector<const ValueSource*>& sources);
+        ~ResolutionChain() = default;
+
+    public:
+        const string& Field() const
+        {
+            return (_field);
+        }
+
+        // ERROR_NONE and the value of the first source that has one, or
+        // ERROR_GENERAL with the value untouched.
+        uint32_t Resolve(string& value) const;
+
+        // The source that answered the last successful Resolve, if any.
+        const ValueSource* Winner() const;
+
+    private:
+        const string _field;
+        const std::vector<const ValueSource*> _sources;
+        mutable std::atomic<int32_t> _winner;
+    };
+
+} // namespace Plugin
+} // namespace WPEFramework
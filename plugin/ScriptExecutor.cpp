@@ -0,0 +1,156 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2026 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+#include "ScriptExecutor.h"
+
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+extern char** environ;
+
+namespace WPEFramework {
+namespace Plugin {
+
+    constexpr size_t ScriptExecutor::MaxOutput;
+
+    ScriptExecutor::ScriptExecutor()
+        : _timeout(5000)
+    {
+    }
+
+    void ScriptExecutor::Configure(const uint32_t timeout)
+    {
+        _timeout = timeout;
+    }
+
+    uint32_t ScriptExecutor::Execute(const char* const arguments[], string& output) const
+    {
+        ASSERT((arguments != nullptr) && (arguments[0] != nullptr));
+
+        int channel[2];
+        if (pipe2(channel, O_CLOEXEC) != 0) {
+            TRACE(Trace::Error, (_T("Could not create a pipe for %s: %d"), arguments[0], errno));
+            return Core::ERROR_GENERAL;
+        }
+
+        posix_spawn_file_actions_t actions;
+        posix_spawnattr_t attributes;
+        sigset_t signals;
+
+        posix_spawn_file_actions_init(&actions);
+        posix_spawn_file_actions_addopen(&actions, STDIN_FILENO, "/dev/null", O_RDONLY, 0);
+        posix_spawn_file_actions_adddup2(&actions, channel[1], STDOUT_FILENO);
+        posix_spawnattr_init(&attributes);
+        posix_spawnattr_setflags(&attributes, POSIX_SPAWN_SETPGROUP | POSIX_SPAWN_SETSIGMASK | POSIX_SPAWN_SETSIGDEF);
+        posix_spawnattr_setpgroup(&attributes, 0);
+        sigemptyset(&signals);
+        posix_spawnattr_setsigmask(&attributes, &signals);
+        sigaddset(&signals, SIGPIPE);
+        sigaddset(&signals, SIGCHLD);
+        posix_spawnattr_setsigdefault(&attributes, &signals);
+
+        pid_t pid;
+        const int error = posix_spawn(&pid, arguments[0], &actions, &attributes, const_cast<char* const*>(arguments), environ);
+
+        posix_spawnattr_destroy(&attributes);
+        posix_spawn_file_actions_destroy(&actions);
+        close(channel[1]);
+
+        if (error != 0) {
+            TRACE(Trace::Error, (_T("Could not run %s: %d"), arguments[0], error));
+            close(channel[0]);
+            return Core::ERROR_GENERAL;
+        }
+
+        uint32_t result = Core::ERROR_NONE;
+        const uint32_t timeout = _timeout;
+        const uint64_t deadline = Core::Time::Now().Ticks() + (static_cast<uint64_t>(timeout) * Core::Time::TicksPerMillisecond);
+        char buffer[MaxOutput + 1];
+        size_t length = 0;
+        bool open = true;
+
+        while ((open == true) && (result == Core::ERROR_NONE)) {
+            const uint64_t now = Core::Time::Now().Ticks();
+            struct pollfd descriptor = { channel[0], POLLIN, 0 };
+            const int ready = (now < deadline)
+                ? poll(&descriptor, 1, static_cast<int>((deadline - now + Core::Time::TicksPerMillisecond - 1) / Core::Time::TicksPerMillisecond))
+                : 0;
+
+            if (ready == 0) {
+                result = Core::ERROR_TIMEDOUT;
+            } else if (ready > 0) {
+                // One byte of headroom tells a full buffer from an overflow.
+                const ssize_t received = read(channel[0], buffer + length, sizeof(buffer) - length);
+                if (received == 0) {
+                    open = false;
+                } else if (received > 0) {
+                    length += received;
+                    if (length > MaxOutput) {
+                        TRACE(Trace::Error, (_T("%s wrote more than %u bytes"), arguments[0], static_cast<uint32_t>(MaxOutput)));
+                        result = Core::ERROR_GENERAL;
+                    }
+                } else if (errno != EINTR) {
+                    result = Core::ERROR_GENERAL;
+                }
+            } else if (errno != EINTR) {
+                result = Core::ERROR_GENERAL;
+            }
+        }
+
+        close(channel[0]);
+
+        // The output is complete, but the program may still be running.
+        int status = 0;
+        pid_t reaped;
+        uint32_t delay = 1;
+        while (((reaped = waitpid(pid, &status, WNOHANG)) == 0) && (result == Core::ERROR_NONE)) {
+            if (Core::Time::Now().Ticks() >= deadline) {
+                result = Core::ERROR_TIMEDOUT;
+            } else {
+                usleep(delay * 1000);
+                delay = std::min(delay * 2, 32u);
+            }
+        }
+
+        if (reaped == 0) {
+            kill(-pid, SIGKILL);
+            while ((waitpid(pid, &status, 0) < 0) && (errno == EINTR)) {
+            }
+        }
+
+        if (result == Core::ERROR_TIMEDOUT) {
+            TRACE(Trace::Error, (_T("%s did not finish within %u ms"), arguments[0], timeout));
+        } else if ((result == Core::ERROR_NONE) && ((reaped < 0) || (WIFEXITED(status) == false) || (WEXITSTATUS(status) != 0))) {
+            TRACE(Trace::Error, (_T("%s failed with status %d"), arguments[0], status));
+            result = Core::ERROR_GENERAL;
+        }
+
+        if (result == Core::ERROR_NONE) {
+            output.assign(buffer, length);
+        }
+
+        return result;
+    }
+
+} // namespace Plugin
+} // namespace WPEFramework
@@ -0,0 +1,59 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2026 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+#pragma once
+
+#include "Module.h"
+
+#include <atomic>
+
+namespace WPEFramework {
+namespace Plugin {
+
+    // Runs a helper script without forking the (large) host process:
+    // posix_spawn shares the address space until the exec instead of
+    // copying its page tables. The child gets /dev/null as stdin, its own
+    // process group and default signal handling; its stdout is collected
+    // into a buffer of at most MaxOutput bytes. A child that outlives the
+    // timeout or writes more than that is killed with its process group.
+    class ScriptExecutor {
+    public:
+        static constexpr size_t MaxOutput = 4096;
+
+        ScriptExecutor(const ScriptExecutor&) = delete;
+        ScriptExecutor& operator=(const ScriptExecutor&) = delete;
+
+        ScriptExecutor();
+        ~ScriptExecutor() = default;
+
+    public:
+        // timeout in ms.
+        void Configure(const uint32_t timeout);
+
+        // arguments[0] is the program and the list ends with nullptr. ERROR_NONE
+        // and the output when the program exits with 0, ERROR_TIMEDOUT when it
+        // was killed for running too long, ERROR_GENERAL otherwise.
+        uint32_t Execute(const char* const arguments[], string& output) const;
+
+    private:
+        std::atomic<uint32_t> _timeout;
+    };
+
+} // namespace Plugin
+} // namespace WPEFramework
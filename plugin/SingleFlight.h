@@ -0,0 +1,172 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2026 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+#pragma once
+
+#include "Module.h"
+
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace WPEFramework {
+namespace Plugin {
+
+    // Collapses concurrent identical requests into one backend call. The first
+    // caller for a key runs the fetch; callers arriving while it is in flight
+    // wait for it and receive a copy of its value and result code. Nothing is
+    // cached: once the call completed the next caller starts a new one.
+    // A key must always be used with the same value type.
+    class SingleFlight {
+    private:
+        struct Call {
+            Call()
+                : done(false)
+                , waiters(0)
+                , result(Core::ERROR_GENERAL)
+                , value()
+            {
+            }
+
+            bool done;
+            uint32_t waiters;
+            uint32_t result;
+            std::shared_ptr<void> value;
+        };
+
+        // Completes the call it was created for: with the fetched value through
+        // Complete(), or with ERROR_GENERAL when the fetch unwinds, so waiters
+        // are never left blocked on a call that will not finish.
+        class Flight {
+        public:
+            Flight(const Flight&) = delete;
+            Flight& operator=(const Flight&) = delete;
+
+            Flight(SingleFlight& parent, const string& key, const std::shared_ptr<Call>& call)
+                : _parent(parent)
+                , _key(key)
+                , _call(call)
+                , _finished(false)
+            {
+            }
+            ~Flight()
+            {
+                if (_finished == false) {
+                    std::unique_lock<std::mutex> lock(_parent._lock);
+                    Finish(lock, Core::ERROR_GENERAL);
+                }
+            }
+
+        public:
+            template <typename VALUE>
+            void Complete(const VALUE& value, const uint32_t result)
+            {
+                std::unique_lock<std::mutex> lock(_parent._lock);
+                // Only pay for the copy when somebody is waiting for it.
+                if (_call->waiters > 0) {
+                    _call->value = std::make_shared<VALUE>(value);
+                }
+                Finish(lock, result);
+            }
+
+        private:
+            void Finish(std::unique_lock<std::mutex>& lock, const uint32_t result)
+            {
+                _call->result = result;
+                _call->done = true;
+                _parent._calls.erase(_key);
+                _finished = true;
+                lock.unlock();
+
+                _parent._completed.notify_all();
+            }
+
+        private:
+            SingleFlight& _parent;
+            const string& _key;
+            std::shared_ptr<Call> _call;
+            bool _finished;
+        };
+
+    public:
+        SingleFlight(const SingleFlight&) = delete;
+        SingleFlight& operator=(const SingleFlight&) = delete;
+
+        SingleFlight()
+            : _lock()
+            , _completed()
+            , _calls()
+        {
+        }
+        ~SingleFlight()
+        {
+            ASSERT(_calls.empty() == true);
+        }
+
+    public:
+        template <typename VALUE, typename FETCH>
+        uint32_t Do(const string& key, VALUE& value, FETCH&& fetch)
+        {
+            std::unique_lock<std::mutex> lock(_lock);
+
+            auto index = _calls.find(key);
+
+            if (index != _calls.end()) {
+                std::shared_ptr<Call> call(index->second);
+                call->waiters++;
+                _completed.wait(lock, [&call]() { return (call->done); });
+
+                if (call->value != nullptr) {
+                    value = *static_cast<const VALUE*>(call->value.get());
+                }
+                return (call->result);
+            }
+
+            std::shared_ptr<Call> call(std::make_shared<Call>());
+            _calls.emplace(key, call);
+            lock.unlock();
+
+            Flight flight(*this, key, call);
+
+            const uint32_t result = fetch(value);
+
+            flight.Complete(value, result);
+
+            return (result);
+        }
+
+        // Callers currently waiting for the call in flight for key.
+        uint32_t Waiting(const string& key)
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+
+            auto index = _calls.find(key);
+
+            return ((index != _calls.end()) ? index->second->waiters : 0);
+        }
+
+    private:
+        std::mutex _lock;
+        std::condition_variable _completed;
+        std::map<string, std::shared_ptr<Call>> _calls;
+    };
+
+} // namespace Plugin
+} // namespace WPEFramework
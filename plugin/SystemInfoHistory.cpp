@@ -0,0 +1,89 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2026 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+
+#include "SystemInfoHistory.h"
+
+namespace WPEFramework {
+namespace Plugin {
+
+    SystemInfoHistory::SystemInfoHistory()
+        : _adminLock()
+        , _entries()
+        , _next(0)
+        , _count(0)
+    {
+    }
+
+    void SystemInfoHistory::Capacity(const uint32_t samples)
+    {
+        std::vector<Entry> entries(samples);
+
+        _adminLock.Lock();
+        _entries.swap(entries);
+        _next = 0;
+        _count = 0;
+        _adminLock.Unlock();
+    }
+
+    uint32_t SystemInfoHistory::Capacity() const
+    {
+        _adminLock.Lock();
+        const uint32_t capacity = static_cast<uint32_t>(_entries.size());
+        _adminLock.Unlock();
+
+        return (capacity);
+    }
+
+    void SystemInfoHistory::Add(const Entry& entry)
+    {
+        _adminLock.Lock();
+
+        if (_entries.empty() == false) {
+            _entries[_next] = entry;
+            _next = (_next + 1) % static_cast<uint32_t>(_entries.size());
+            if (_count < _entries.size()) {
+                _count++;
+            }
+        }
+
+        _adminLock.Unlock();
+    }
+
+    void SystemInfoHistory::Entries(const uint32_t window, std::list<Entry>& entries) const
+    {
+        const uint64_t now = Core::Time::Now().Ticks();
+        const uint64_t span = static_cast<uint64_t>(window) * 1000 * Core::Time::TicksPerMillisecond;
+        const uint64_t since = (now > span) ? (now - span) : 0;
+
+        _adminLock.Lock();
+
+        const uint32_t size = static_cast<uint32_t>(_entries.size());
+        for (uint32_t index = 0; index < _count; index++) {
+            const Entry& entry(_entries[(_next + size - _count + index) % size]);
+            if (entry.time >= since) {
+                entries.push_back(entry);
+            }
+        }
+
+        _adminLock.Unlock();
+    }
+
+} // namespace Plugin
+} // namespace WPEFramework
@@ -0,0 +1,70 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2026 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+
+#pragma once
+
+#include "Module.h"
+
+#include <list>
+#include <vector>
+
+namespace WPEFramework {
+namespace Plugin {
+
+    // Fixed-size ring of the most recent load and memory samples. Storage is
+    // allocated once, when the capacity is set; adding a sample never
+    // allocates and overwrites the oldest one when the ring is full.
+    class SystemInfoHistory {
+    public:
+        struct Entry {
+            uint64_t time; // Core::Time ticks
+            uint32_t cpuload;
+            uint64_t freeram;
+            uint64_t freeswap;
+            uint64_t avg1min;
+            uint64_t avg5min;
+            uint64_t avg15min;
+        };
+
+        SystemInfoHistory(const SystemInfoHistory&) = delete;
+        SystemInfoHistory& operator=(const SystemInfoHistory&) = delete;
+
+        SystemInfoHistory();
+        ~SystemInfoHistory() = default;
+
+    public:
+        // Drops the samples kept so far; 0 releases the storage.
+        void Capacity(const uint32_t samples);
+        uint32_t Capacity() const;
+
+        void Add(const Entry& entry);
+
+        // The samples of the last window seconds, oldest first.
+        void Entries(const uint32_t window, std::list<Entry>& entries) const;
+
+    private:
+        mutable Core::CriticalSection _adminLock;
+        std::vector<Entry> _entries;
+        uint32_t _next;
+        uint32_t _count;
+    };
+
+} // namespace Plugin
+} // namespace WPEFramework
@@ -0,0 +1,125 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2026 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+
+#include "SystemInfoSampler.h"
+
+namespace WPEFramework {
+namespace Plugin {
+
+    SystemInfoSampler::SystemInfoSampler()
+        : _callback(nullptr)
+        , _interval(0)
+        , _latest()
+        , _spare()
+        , _stopLock()
+        , _stopSignal()
+        , _stop(false)
+        , _thread()
+    {
+    }
+
+    SystemInfoSampler::~SystemInfoSampler()
+    {
+        Stop();
+    }
+
+    void SystemInfoSampler::Start(const ICallback* callback, const uint32_t interval)
+    {
+        ASSERT(callback != nullptr);
+        ASSERT(interval > 0);
+        ASSERT(_thread.joinable() == false);
+
+        _callback = callback;
+        _interval = interval;
+        _stop = false;
+
+        Publish();
+
+        _thread = std::thread(&SystemInfoSampler::Run, this);
+    }
+
+    void SystemInfoSampler::Stop()
+    {
+        if (_thread.joinable() == true) {
+            {
+                std::lock_guard<std::mutex> guard(_stopLock);
+                _stop = true;
+            }
+            _stopSignal.notify_all();
+            _thread.join();
+        }
+
+        std::atomic_store(&_latest, std::shared_ptr<Record>());
+        _spare.reset();
+        _callback = nullptr;
+    }
+
+    bool SystemInfoSampler::Running() const
+    {
+        return (std::atomic_load(&_latest) != nullptr);
+    }
+
+    bool SystemInfoSampler::Latest(Exchange::IDeviceInfo::SystemInfos& info, uint64_t& sampled) const
+    {
+        const std::shared_ptr<const Record> record(std::atomic_load(&_latest));
+
+        if (record != nullptr) {
+            info = record->info;
+            sampled = record->sampled;
+        }
+
+        return (record != nullptr);
+    }
+
+    void SystemInfoSampler::Run()
+    {
+        std::unique_lock<std::mutex> guard(_stopLock);
+
+        while (_stopSignal.wait_for(guard, std::chrono::milliseconds(_interval), [this]() { return (_stop); }) == false) {
+            guard.unlock();
+            Publish();
+            guard.lock();
+        }
+    }
+
+    void SystemInfoSampler::Publish()
+    {
+        // Once replaced, a record can only be reached through the readers that
+        // copied it before; when none is left it is ours to fill again.
+        if ((_spare == nullptr) || (_spare.use_count() > 1)) {
+            _spare = std::make_shared<Record>();
+        }
+
+        const std::shared_ptr<Record> latest(std::atomic_load(&_latest));
+        if (latest != nullptr) {
+            // Assigning into the recycled record reuses its string storage.
+            _spare->info = latest->info;
+        } else {
+            _spare->info = Exchange::IDeviceInfo::SystemInfos();
+        }
+
+        _callback->Sample(_spare->info);
+        _spare->sampled = Core::Time::Now().Ticks();
+
+        _spare = std::atomic_exchange(&_latest, std::move(_spare));
+    }
+
+} // namespace Plugin
+} // namespace WPEFramework
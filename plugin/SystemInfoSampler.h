@@ -0,0 +1,90 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2026 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+
+#pragma once
+
+#include "Module.h"
+
+#include <interfaces/IDeviceInfo.h>
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace WPEFramework {
+namespace Plugin {
+
+    // Refreshes the SystemInfo() record on its own thread at a fixed interval
+    // and publishes every sample as an immutable record behind an atomically
+    // swapped shared_ptr. Readers copy the latest record without taking a lock
+    // or touching /proc, MFR or the subsystems. The record a sample replaces
+    // is filled again by the next one once no reader holds it any more, so a
+    // steady state sampler does not allocate.
+    class SystemInfoSampler {
+    public:
+        struct ICallback {
+            virtual ~ICallback() = default;
+
+            // Called on the sampler thread with the previous sample (empty the
+            // first time), so values that do not change can be kept.
+            virtual void Sample(Exchange::IDeviceInfo::SystemInfos& info) const = 0;
+        };
+
+        SystemInfoSampler(const SystemInfoSampler&) = delete;
+        SystemInfoSampler& operator=(const SystemInfoSampler&) = delete;
+
+        SystemInfoSampler();
+        ~SystemInfoSampler();
+
+    public:
+        // Takes the first sample before returning, so Latest() succeeds at once.
+        // interval in ms.
+        void Start(const ICallback* callback, const uint32_t interval);
+        void Stop();
+        bool Running() const;
+
+        // The latest sample and when it was taken (Core::Time ticks); false
+        // when the sampler is not running.
+        bool Latest(Exchange::IDeviceInfo::SystemInfos& info, uint64_t& sampled) const;
+
+    private:
+        struct Record {
+            Exchange::IDeviceInfo::SystemInfos info;
+            uint64_t sampled;
+        };
+
+        void Run();
+        void Publish();
+
+    private:
+        const ICallback* _callback;
+        uint32_t _interval;
+        std::shared_ptr<Record> _latest;
+        // Only touched by the thread taking the samples.
+        std::shared_ptr<Record> _spare;
+        std::mutex _stopLock;
+        std::condition_variable _stopSignal;
+        bool _stop;
+        std::thread _thread;
+    };
+
+} // namespace Plugin
+} // namespace WPEFramework
@@ -0,0 +1,321 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2026 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+
+#include "ThermalReader.h"
+
+#include <algorithm>
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace WPEFramework {
+namespace Plugin {
+    namespace {
+
+        constexpr const TCHAR ThermalClass[] = _T("/sys/class/thermal/");
+        constexpr const TCHAR CpuDevices[] = _T("/sys/devices/system/cpu/");
+
+        int Open(const string& path)
+        {
+            return (open(path.c_str(), O_RDONLY | O_CLOEXEC));
+        }
+
+        void Close(const int fd)
+        {
+            if (fd != -1) {
+                close(fd);
+            }
+        }
+
+        // The "type" attribute of a zone or cooling device, or fallback when there is none.
+        string Type(const string& path, const char fallback[])
+        {
+            string name(fallback);
+            const int type = Open(path + _T("type"));
+
+            if (type != -1) {
+                char buffer[64];
+                const ssize_t length = read(type, buffer, sizeof(buffer));
+                if (length > 0) {
+                    name.assign(buffer, (buffer[length - 1] == '\n') ? (length - 1) : length);
+                }
+                close(type);
+            }
+
+            return (name);
+        }
+
+        template <typename FILES>
+        void Sorted(std::vector<std::pair<uint32_t, FILES>>& found, std::vector<FILES>& files)
+        {
+            std::sort(found.begin(), found.end(), [](const std::pair<uint32_t, FILES>& lhs, const std::pair<uint32_t, FILES>& rhs) { return (lhs.first < rhs.first); });
+            for (const std::pair<uint32_t, FILES>& entry : found) {
+                files.push_back(entry.second);
+            }
+        }
+
+        // The attribute as a (signed) integer; false when it can not be read.
+        bool Value(const int fd, int64_t& value)
+        {
+            char buffer[32];
+            const ssize_t length = (fd != -1) ? pread(fd, buffer, sizeof(buffer), 0) : -1;
+
+            if (length <= 0) {
+                return (false);
+            }
+
+            const char* text = buffer;
+            const char* const end = buffer + length;
+            const bool negative = (*text == '-');
+            if (negative == true) {
+                text++;
+            }
+
+            value = 0;
+            while ((text < end) && (*text >= '0') && (*text <= '9')) {
+                value = (value * 10) + (*text - '0');
+                text++;
+            }
+            if (negative == true) {
+                value = -value;
+            }
+
+            return (true);
+        }
+
+        // The numeric suffix of "<prefix><n>" entries such as thermal_zone3 or cpu1.
+        bool Index(const char name[], const char prefix[], uint32_t& index)
+        {
+            const size_t length = strlen(prefix);
+
+            if ((strncmp(name, prefix, length) != 0) || (name[length] == '\0')) {
+                return (false);
+            }
+
+            index = 0;
+            for (const char* digit = name + length; *digit != '\0'; digit++) {
+                if ((*digit < '0') || (*digit > '9')) {
+                    return (false);
+                }
+                index = (index * 10) + (*digit - '0');
+            }
+
+            return (true);
+        }
+    }
+
+    ThermalReader::ThermalReader()
+        : ThermalReader(ThermalClass, CpuDevices)
+    {
+    }
+
+    ThermalReader::ThermalReader(const string& thermalClass, const string& cpuDevices)
+        : _zones()
+        , _coolings()
+        , _cpus()
+    {
+        DiscoverThermal(thermalClass);
+        DiscoverCpus(cpuDevices);
+    }
+
+    ThermalReader::~ThermalReader()
+    {
+        Release();
+    }
+
+    void ThermalReader::Configure(const string& thermalClass, const string& cpuDevices)
+    {
+        Release();
+        DiscoverThermal(thermalClass.empty() == true ? string(ThermalClass) : thermalClass);
+        DiscoverCpus(cpuDevices.empty() == true ? string(CpuDevices) : cpuDevices);
+    }
+
+    void ThermalReader::Release()
+    {
+        for (const ZoneFiles& zone : _zones) {
+            close(zone.temperature);
+        }
+        for (const CoolingFiles& cooling : _coolings) {
+            close(cooling.state);
+            Close(cooling.maxState);
+            Close(cooling.transitions);
+        }
+        for (const CpuFiles& cpu : _cpus) {
+            Close(cpu.frequency);
+            Close(cpu.maxFrequency);
+        }
+        _zones.clear();
+        _coolings.clear();
+        _cpus.clear();
+    }
+
+    void ThermalReader::DiscoverThermal(const string& thermalClass)
+    {
+        DIR* directory = opendir(thermalClass.c_str());
+
+        if (directory != nullptr) {
+            std::vector<std::pair<uint32_t, ZoneFiles>> zones;
+            std::vector<std::pair<uint32_t, CoolingFiles>> coolings;
+            struct dirent* entry;
+
+            while ((entry = readdir(directory)) != nullptr) {
+                uint32_t index;
+                const string path = thermalClass + entry->d_name + _T("/");
+
+                if (Index(entry->d_name, "thermal_zone", index) == true) {
+                    const int temperature = Open(path + _T("temp"));
+
+                    if (temperature != -1) {
+                        zones.push_back({ index, { Type(path, entry->d_name), temperature } });
+                    }
+                } else if (Index(entry->d_name, "cooling_device", index) == true) {
+                    const int state = Open(path + _T("cur_state"));
+
+                    if (state != -1) {
+                        coolings.push_back({ index, { Type(path, entry->d_name), state, Open(path + _T("max_state")), Open(path + _T("stats/total_trans")) } });
+                    }
+                }
+            }
+
+            closedir(directory);
+
+            Sorted(zones, _zones);
+            Sorted(coolings, _coolings);
+        }
+    }
+
+    void ThermalReader::DiscoverCpus(const string& cpuDevices)
+    {
+        DIR* directory = opendir(cpuDevices.c_str());
+
+        if (directory != nullptr) {
+            std::vector<std::pair<uint32_t, CpuFiles>> cpus;
+            struct dirent* entry;
+
+            while ((entry = readdir(directory)) != nullptr) {
+                uint32_t id;
+                if (Index(entry->d_name, "cpu", id) == false) {
+                    continue;
+                }
+
+                const string path = cpuDevices + entry->d_name + _T("/");
+                const CpuFiles cpu = {
+                    id,
+                    Open(path + _T("cpufreq/scaling_cur_freq")),
+                    Open(path + _T("cpufreq/cpuinfo_max_freq"))
+                };
+
+                if (cpu.frequency != -1) {
+                    cpus.push_back({ id, cpu });
+                } else {
+                    Close(cpu.maxFrequency);
+                }
+            }
+
+            closedir(directory);
+
+            Sorted(cpus, _cpus);
+        }
+    }
+
+    uint32_t ThermalReader::Read(Sample& sample) const
+    {
+        if ((_zones.empty() == true) && (_coolings.empty() == true) && (_cpus.empty() == true)) {
+            return (Core::ERROR_UNAVAILABLE);
+        }
+
+        // Same sizes every time, so a reused sample keeps its storage.
+        sample.zones.resize(_zones.size());
+        sample.coolings.resize(_coolings.size());
+        sample.cpus.resize(_cpus.size());
+
+        for (size_t index = 0; index < _zones.size(); index++) {
+            Zone& zone(sample.zones[index]);
+            int64_t value;
+
+            if (zone.name != _zones[index].name) {
+                zone.name = _zones[index].name;
+            }
+            zone.temperature = (Value(_zones[index].temperature, value) == true) ? static_cast<int32_t>(value) : 0;
+        }
+
+        for (size_t index = 0; index < _coolings.size(); index++) {
+            const CoolingFiles& files(_coolings[index]);
+            Cooling& cooling(sample.coolings[index]);
+            int64_t value;
+
+            if (cooling.name != files.name) {
+                cooling.name = files.name;
+            }
+            cooling.state = (Value(files.state, value) == true) ? static_cast<uint32_t>(value) : 0;
+            cooling.maxState = (Value(files.maxState, value) == true) ? static_cast<uint32_t>(value) : 0;
+            cooling.transitions = (Value(files.transitions, value) == true) ? static_cast<uint64_t>(value) : 0;
+        }
+
+        for (size_t index = 0; index < _cpus.size(); index++) {
+            const CpuFiles& files(_cpus[index]);
+            Cpu& cpu(sample.cpus[index]);
+            int64_t value;
+
+            cpu.id = files.id;
+            cpu.frequency = (Value(files.frequency, value) == true) ? static_cast<uint32_t>(value) : 0;
+            cpu.maxFrequency = (Value(files.maxFrequency, value) == true) ? static_cast<uint32_t>(value) : 0;
+        }
+
+        return (Core::ERROR_NONE);
+    }
+
+    ThermalThreshold::ThermalThreshold()
+        : _threshold(0)
+        , _hysteresis(0)
+        , _above()
+    {
+    }
+
+    void ThermalThreshold::Configure(const uint32_t threshold, const uint32_t hysteresis)
+    {
+        _threshold = threshold;
+        _hysteresis = std::min(hysteresis, threshold);
+        _above.clear();
+    }
+
+    void ThermalThreshold::Update(const std::vector<ThermalReader::Zone>& zones, std::list<Crossing>& crossings)
+    {
+        if (_threshold == 0) {
+            return;
+        }
+
+        _above.resize(zones.size(), false);
+
+        for (size_t index = 0; index < zones.size(); index++) {
+            const ThermalReader::Zone& zone(zones[index]);
+            const bool above = (_above[index] == true)
+                ? (zone.temperature >= static_cast<int32_t>(_threshold - _hysteresis))
+                : (zone.temperature >= static_cast<int32_t>(_threshold));
+
+            if (above != _above[index]) {
+                _above[index] = above;
+                crossings.push_back({ zone.name, zone.temperature, above });
+            }
+        }
+    }
+
+} // namespace Plugin
+} // namespace WPEFramework
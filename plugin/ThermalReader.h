@@ -0,0 +1,136 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2026 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+
+#pragma once
+
+#include "Module.h"
+
+#include <list>
+#include <vector>
+
+namespace WPEFramework {
+namespace Plugin {
+
+    // Thermal zone temperatures, the state of every thermal cooling device and
+    // per core current and maximum cpufreq. A cooling device is whatever the
+    // thermal framework throttles with (cpufreq, devfreq, a fan), so its
+    // transition count is the throttle counter on every architecture. The
+    // zones, devices and cores are discovered once at construction and their
+    // sysfs attributes kept open, so a sample is a pread() per attribute.
+    class ThermalReader {
+    public:
+        struct Zone {
+            string name; // thermal zone "type"
+            int32_t temperature; // millidegree Celsius
+        };
+
+        struct Cooling {
+            string name; // cooling device "type"
+            uint32_t state; // 0 is not throttling
+            uint32_t maxState;
+            uint64_t transitions; // 0 without the statistics
+        };
+
+        struct Cpu {
+            uint32_t id;
+            uint32_t frequency; // kHz
+            uint32_t maxFrequency; // kHz
+        };
+
+        struct Sample {
+            std::vector<Zone> zones;
+            std::vector<Cooling> coolings;
+            std::vector<Cpu> cpus;
+        };
+
+        ThermalReader(const ThermalReader&) = delete;
+        ThermalReader& operator=(const ThermalReader&) = delete;
+
+        ThermalReader();
+        // Roots in place of /sys/class/thermal/ and /sys/devices/system/cpu/, with a trailing '/'.
+        ThermalReader(const string& thermalClass, const string& cpuDevices);
+        ~ThermalReader();
+
+    public:
+        // Closes what was discovered and discovers again below the given roots, an
+        // empty one standing for the sysfs default; not to be called while a Read() may run.
+        void Configure(const string& thermalClass, const string& cpuDevices);
+        // ERROR_UNAVAILABLE when the platform exports neither zones, cooling devices nor cpufreq.
+        uint32_t Read(Sample& sample) const;
+
+    private:
+        struct ZoneFiles {
+            string name;
+            int temperature;
+        };
+
+        struct CoolingFiles {
+            string name;
+            int state;
+            int maxState;
+            int transitions;
+        };
+
+        struct CpuFiles {
+            uint32_t id;
+            int frequency;
+            int maxFrequency;
+        };
+
+        void DiscoverThermal(const string& thermalClass);
+        void DiscoverCpus(const string& cpuDevices);
+        void Release();
+
+    private:
+        std::vector<ZoneFiles> _zones;
+        std::vector<CoolingFiles> _coolings;
+        std::vector<CpuFiles> _cpus;
+    };
+
+    // Which zones are at or above a threshold. A zone counts as above once it
+    // reaches the threshold and until it drops below it by the hysteresis.
+    class ThermalThreshold {
+    public:
+        struct Crossing {
+            string zone;
+            int32_t temperature;
+            bool above;
+        };
+
+        ThermalThreshold(const ThermalThreshold&) = delete;
+        ThermalThreshold& operator=(const ThermalThreshold&) = delete;
+
+        ThermalThreshold();
+        ~ThermalThreshold() = default;
+
+    public:
+        // millidegree Celsius; a threshold of 0 reports nothing. Every zone starts below.
+        void Configure(const uint32_t threshold, const uint32_t hysteresis);
+        // Adds a crossing for every zone that went above or back below since the previous update.
+        void Update(const std::vector<ThermalReader::Zone>& zones, std::list<Crossing>& crossings);
+
+    private:
+        uint32_t _threshold;
+        uint32_t _hysteresis;
+        std::vector<bool> _above;
+    };
+
+} // namespace Plugin
+} // namespace WPEFramework